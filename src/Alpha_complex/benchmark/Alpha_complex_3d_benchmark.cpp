@@ -97,6 +97,66 @@ void benchmark_points_on_torus_3D(const std::string& msg) {
   }
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+template <typename Alpha_complex_3d, typename Parallel_alpha_complex_3d>
+void benchmark_parallel_points_on_torus_3D(const std::string& msg) {
+  using K = CGAL::Epick_d<CGAL::Dimension_tag<3>>;
+  std::cout << "+ " << msg << std::endl;
+
+  results_csv << "\"" << msg << "\";" << std::endl;
+  results_csv << "\"nb_points\";"
+              << "\"nb_simplices\";"
+              << "\"alpha_creation_time(sec.)\";"
+              << "\"complex_creation_time(sec.)\";"
+              << "\"parallel_alpha_creation_time(sec.)\";"
+              << "\"parallel_complex_creation_time(sec.)\";" << std::endl;
+
+  for (int nb_points = 10000; nb_points <= 10000000; nb_points *= 10) {
+    std::cout << "  Alpha complex 3d on torus with " << nb_points << " points." << std::endl;
+    std::vector<K::Point_d> points_on_torus = Gudhi::generate_points_on_torus_3D<K>(nb_points, 1.0, 0.5);
+    std::vector<typename Alpha_complex_3d::Point_3> points;
+
+    for (auto p : points_on_torus) {
+      points.push_back(typename Alpha_complex_3d::Point_3(p[0], p[1], p[2]));
+    }
+
+    Gudhi::Clock ac_create_clock("    benchmark_parallel_points_on_torus_3D - Alpha complex 3d creation");
+    ac_create_clock.begin();
+    Alpha_complex_3d alpha_complex_from_points(points);
+    ac_create_clock.end();
+    std::cout << ac_create_clock;
+
+    Gudhi::Simplex_tree<> complex;
+    Gudhi::Clock st_create_clock("    benchmark_parallel_points_on_torus_3D - complex creation");
+    st_create_clock.begin();
+    alpha_complex_from_points.create_complex(complex);
+    st_create_clock.end();
+    std::cout << st_create_clock;
+
+    Gudhi::Clock parallel_ac_create_clock(
+        "    benchmark_parallel_points_on_torus_3D - Parallel alpha complex 3d creation");
+    parallel_ac_create_clock.begin();
+    Parallel_alpha_complex_3d parallel_alpha_complex_from_points(points);
+    parallel_ac_create_clock.end();
+    std::cout << parallel_ac_create_clock;
+
+    Gudhi::Simplex_tree<> parallel_complex;
+    Gudhi::Clock parallel_st_create_clock("    benchmark_parallel_points_on_torus_3D - Parallel complex creation");
+    parallel_st_create_clock.begin();
+    parallel_alpha_complex_from_points.create_complex(parallel_complex);
+    parallel_st_create_clock.end();
+    std::cout << parallel_st_create_clock;
+
+    results_csv << nb_points << ";" << complex.num_simplices() << ";" << ac_create_clock.num_seconds() << ";"
+                << st_create_clock.num_seconds() << ";" << parallel_ac_create_clock.num_seconds() << ";"
+                << parallel_st_create_clock.num_seconds() << ";" << std::endl;
+
+    std::cout << "    benchmark_parallel_points_on_torus_3D - nb simplices = " << complex.num_simplices()
+              << " - parallel = " << parallel_complex.num_simplices() << std::endl;
+  }
+}
+#endif  // CGAL_LINKED_WITH_TBB
+
 template <typename Weighted_alpha_complex_3d>
 void benchmark_weighted_points_on_torus_3D(const std::string& msg) {
   using K = CGAL::Epick_d<CGAL::Dimension_tag<3>>;
@@ -253,6 +313,17 @@ int main(int argc, char** argv) {
   benchmark_points_on_torus_3D<
       Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::EXACT, false, false>>("Exact version");
 
+#ifdef CGAL_LINKED_WITH_TBB
+  benchmark_parallel_points_on_torus_3D<
+      Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, false, false>,
+      Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, false, false,
+                                             CGAL::Parallel_tag>>("Fast parallel version");
+  benchmark_parallel_points_on_torus_3D<
+      Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::SAFE, false, false>,
+      Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::SAFE, false, false,
+                                             CGAL::Parallel_tag>>("Safe parallel version");
+#endif  // CGAL_LINKED_WITH_TBB
+
   benchmark_weighted_points_on_torus_3D<
       Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, true, false>>("Fast version");
   benchmark_weighted_points_on_torus_3D<
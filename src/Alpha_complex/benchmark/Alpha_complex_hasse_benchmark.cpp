@@ -0,0 +1,61 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Alpha_complex.h>
+// to construct a simplex_tree from alpha complex
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Hasse_complex.h>
+#include <gudhi/random_point_generators.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+
+#include <CGAL/Epick_d.h>
+
+using Kernel = CGAL::Epick_d<CGAL::Dimension_tag<3>>;
+
+int main() {
+  std::ofstream results_csv("results.csv");
+  results_csv << "\"nb_points\";"
+              << "\"nb_simplices\";"
+              << "\"simplex_tree_round_trip_time(sec.)\";"
+              << "\"direct_hasse_complex_time(sec.)\";" << std::endl;
+
+  for (int nb_points = 1000; nb_points <= 125000; nb_points *= 5) {
+    std::cout << "+ Alpha complex on torus with " << nb_points << " points." << std::endl;
+    std::vector<Kernel::Point_d> points = Gudhi::generate_points_on_torus_3D<Kernel>(nb_points, 1.0, 0.5);
+    Gudhi::alpha_complex::Alpha_complex<Kernel> alpha_complex_from_points(points);
+
+    // Through a Simplex_tree: create the complex, sort it, copy the keys inside the simplices and convert it
+    Gudhi::Clock round_trip_clock("    Simplex_tree round trip");
+    round_trip_clock.begin();
+    Gudhi::Simplex_tree<> stree;
+    alpha_complex_from_points.create_complex(stree);
+    stree.initialize_filtration();
+    int count = 0;
+    for (auto sh : stree.filtration_simplex_range())
+      stree.assign_key(sh, count++);
+    Gudhi::Hasse_complex<> round_trip_hasse(stree);
+    round_trip_clock.end();
+    std::cout << round_trip_clock;
+
+    Gudhi::Clock direct_clock("    Direct Hasse_complex");
+    direct_clock.begin();
+    Gudhi::Hasse_complex<> direct_hasse;
+    alpha_complex_from_points.create_complex(direct_hasse);
+    direct_clock.end();
+    std::cout << direct_clock;
+
+    std::cout << "    nb simplices = " << direct_hasse.num_simplices() << " - same number of simplices: "
+              << std::boolalpha << (direct_hasse.num_simplices() == round_trip_hasse.num_simplices()) << std::endl;
+    results_csv << nb_points << ";" << direct_hasse.num_simplices() << ";" << round_trip_clock.num_seconds() << ";"
+                << direct_clock.num_seconds() << ";" << std::endl;
+  }
+  return 0;
+}
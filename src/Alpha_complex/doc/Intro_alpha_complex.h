@@ -105,6 +105,15 @@ namespace alpha_complex {
  * \text{prune_above_filtration()}\\
  * \f$
  *
+ * Within a dimension, the filtration values of the simplices are not modified by one another. When GUDHI is built
+ * with TBB, the \f$\alpha^2\f$ values of the simplices of a dimension with a NaN filtration value are therefore computed
+ * in parallel, before the propagation to their faces.
+ *
+ * The same algorithm is applied when the complex is created as a `Hasse_complex`, that only stores the boundary and
+ * the filtration value of each simplex, in the order of the filtration. The simplices are then kept in sorted arrays,
+ * one per dimension, instead of a `Simplex_tree`, which is lighter when the complex is only built to compute its
+ * persistence.
+ *
  * \subsubsection dimension2 Dimension 2
  *
  * From the example above, it means the algorithm looks into each triangle ([0,1,2], [0,2,4], [1,2,3], ...),
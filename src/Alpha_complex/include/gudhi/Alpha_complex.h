@@ -15,6 +15,7 @@
 #include <gudhi/Debug_utils.h>
 // to construct Alpha_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
+#include <gudhi/Hasse_complex.h>
 
 #include <stdlib.h>
 #include <math.h>  // isnan, fmax
@@ -28,6 +29,11 @@
 
 #include <Eigen/src/Core/util/Macros.h>  // for EIGEN_VERSION_AT_LEAST
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 #include <iostream>
 #include <vector>
 #include <string>
@@ -36,6 +42,8 @@
 #include <utility>  // std::pair
 #include <stdexcept>
 #include <numeric>  // for std::iota
+#include <algorithm>  // for std::sort, std::lexicographical_compare
+#include <type_traits>  // for std::is_floating_point
 
 // Make compilation fail - required for external projects - https://github.com/GUDHI/gudhi-devel/issues/10
 #if CGAL_VERSION_NR < 1041101000
@@ -106,6 +114,9 @@ class Alpha_complex {
   // Map type to switch from simplex tree vertex handle to CGAL vertex iterator.
   typedef typename std::map< std::size_t, CGAL_vertex_iterator > Vector_vertex_iterator;
 
+  // Index of a point, as stored in the vertices of the triangulation.
+  typedef std::ptrdiff_t Point_index;
+
  private:
   /** \brief Vertex iterator vector to switch from simplex tree vertex handle to CGAL vertex iterator.
    * Vertex handles are inserted sequentially, starting at 0.*/
@@ -296,47 +307,42 @@ class Alpha_complex {
     // --------------------------------------------------------------------------------------------
 
     // --------------------------------------------------------------------------------------------
-    // Will be re-used many times
-    Vector_of_CGAL_points pointVector;
+    // Simplices of the current dimension, the ones whose filtration is NaN, and their alpha values
+    std::vector<Simplex_handle> simplices;
+    std::vector<Simplex_handle> nan_simplices;
+    std::vector<Filtration_value> alpha_values;
     // ### For i : d -> 0
     for (int decr_dim = triangulation_->maximal_dimension(); decr_dim >= 0; decr_dim--) {
-      // ### Foreach Sigma of dim i
+      // Filtration values of this dimension are only modified by the propagation from the upper one, already done here
+      simplices.clear();
+      nan_simplices.clear();
       for (Simplex_handle f_simplex : complex.skeleton_simplex_range(decr_dim)) {
-        int f_simplex_dim = complex.dimension(f_simplex);
-        if (decr_dim == f_simplex_dim) {
-          pointVector.clear();
-#ifdef DEBUG_TRACES
-          std::cout << "Sigma of dim " << decr_dim << " is";
-#endif  // DEBUG_TRACES
-          for (auto vertex : complex.simplex_vertex_range(f_simplex)) {
+        if (decr_dim == complex.dimension(f_simplex)) {
+          simplices.push_back(f_simplex);
+          if (std::isnan(complex.filtration(f_simplex)))
+            nan_simplices.push_back(f_simplex);
+        }
+      }
+      // ### Foreach Sigma of dim i, if filt(Sigma) is NaN : filt(Sigma) = alpha(Sigma)
+      alpha_values.assign(nan_simplices.size(), 0.);
+      // No need to compute squared_radius on a single point - alpha is 0.0
+      if (decr_dim > 0) {
+        compute_alpha_values([&](std::size_t index, Vector_of_CGAL_points& pointVector) {
+          for (auto vertex : complex.simplex_vertex_range(nan_simplices[index])) {
             pointVector.push_back(get_point(vertex));
-#ifdef DEBUG_TRACES
-            std::cout << " " << vertex;
-#endif  // DEBUG_TRACES
           }
+        }, alpha_values);
+      }
+      for (std::size_t i = 0; i < nan_simplices.size(); ++i) {
+        complex.assign_filtration(nan_simplices[i], alpha_values[i]);
 #ifdef DEBUG_TRACES
-          std::cout << std::endl;
-#endif  // DEBUG_TRACES
-          // ### If filt(Sigma) is NaN : filt(Sigma) = alpha(Sigma)
-          if (std::isnan(complex.filtration(f_simplex))) {
-            Filtration_value alpha_complex_filtration = 0.0;
-            // No need to compute squared_radius on a single point - alpha is 0.0
-            if (f_simplex_dim > 0) {
-              // squared_radius function initialization
-              Squared_Radius squared_radius = kernel_.compute_squared_radius_d_object();
-              CGAL::NT_converter<typename Geom_traits::FT, Filtration_value> cv;
-
-              alpha_complex_filtration = cv(squared_radius(pointVector.begin(), pointVector.end()));
-            }
-            complex.assign_filtration(f_simplex, alpha_complex_filtration);
-#ifdef DEBUG_TRACES
-            std::cout << "filt(Sigma) is NaN : filt(Sigma) =" << complex.filtration(f_simplex) << std::endl;
+        std::cout << "filt(Sigma) is NaN : filt(Sigma) =" << complex.filtration(nan_simplices[i]) << std::endl;
 #endif  // DEBUG_TRACES
-          }
-          // No need to propagate further, unweighted points all have value 0
-          if (decr_dim > 1)
-            propagate_alpha_filtration(complex, f_simplex);
-        }
+      }
+      // No need to propagate further, unweighted points all have value 0
+      if (decr_dim > 1) {
+        for (Simplex_handle f_simplex : simplices)
+          propagate_alpha_filtration(complex, f_simplex);
       }
     }
     // --------------------------------------------------------------------------------------------
@@ -350,7 +356,254 @@ class Alpha_complex {
     return true;
   }
 
+ public:
+  /** \brief Inserts all Delaunay triangulation into a Hasse_complex, where the boundary of each simplex is given by
+   * the indices of its facets, without going through a simplicial complex data structure.
+   * It computes the filtration values accordingly to the \ref createcomplexalgorithm, then sorts the simplices by
+   * filtration value, dimension and vertices.
+   *
+   * The resulting complex can be given directly to `Gudhi::persistent_cohomology::Persistent_cohomology`. As their
+   * filtration value is 0, vertices are its first simplices, sorted by point index.
+   *
+   * @param[in] complex Hasse_complex to be created.
+   * @param[in] max_alpha_square maximum for alpha square value. Default value is +\f$\infty\f$.
+   *
+   * @return true if creation succeeds, false otherwise.
+   *
+   * @pre Delaunay triangulation must be already constructed with dimension strictly greater than 0.
+   * @pre The Hasse complex must be empty (no simplices)
+   */
+  template <typename Filtration_value, typename Simplex_key, typename VertexHandle>
+  bool create_complex(Hasse_complex<Filtration_value, Simplex_key, VertexHandle>& complex,
+                      Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity()) {
+    typedef typename Hasse_complex<Filtration_value, Simplex_key, VertexHandle>::Simplex_handle Simplex_handle;
+
+    if (triangulation_ == nullptr) {
+      std::cerr << "Alpha_complex cannot create_complex from a NULL triangulation\n";
+      return false;  // ----- >>
+    }
+    if (triangulation_->maximal_dimension() < 1) {
+      std::cerr << "Alpha_complex cannot create_complex from a zero-dimension triangulation\n";
+      return false;  // ----- >>
+    }
+    if (complex.num_simplices() > 0) {
+      std::cerr << "Alpha_complex create_complex - complex is not empty\n";
+      return false;  // ----- >>
+    }
+
+    // --------------------------------------------------------------------------------------------
+    // The simplices of dimension d are stored by their d + 1 sorted vertices in simplices[d], in lexicographic
+    // order, and the indices of their facets in boundaries[d], the i-th one being the facet without the i-th vertex
+    int max_dim = triangulation_->maximal_dimension();
+    std::vector<std::vector<Point_index>> simplices(max_dim + 1);
+    std::vector<std::vector<std::size_t>> boundaries(max_dim + 1);
+    std::vector<Point_index> cell;
+    for (auto cit = triangulation_->finite_full_cells_begin(); cit != triangulation_->finite_full_cells_end(); ++cit) {
+      cell.clear();
+      for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit) {
+        if (*vit != nullptr) cell.push_back((*vit)->data());
+      }
+      std::sort(cell.begin(), cell.end());
+      // Every non-empty subset of the vertices of the cell is one of its faces
+      for (std::size_t subset = 1; subset < (std::size_t(1) << cell.size()); ++subset) {
+        int dim = -1;
+        for (std::size_t i = 0; i < cell.size(); ++i) dim += (subset >> i) & 1;
+        for (std::size_t i = 0; i < cell.size(); ++i) {
+          if ((subset >> i) & 1) simplices[dim].push_back(cell[i]);
+        }
+      }
+    }
+    for (int dim = 0; dim <= max_dim; ++dim) {
+      sort_unique_simplices(simplices[dim], dim + 1);
+    }
+    std::vector<Point_index> facet;
+    for (int dim = 1; dim <= max_dim; ++dim) {
+      std::size_t num_simplices = simplices[dim].size() / (dim + 1);
+      boundaries[dim].reserve(num_simplices * (dim + 1));
+      for (std::size_t index = 0; index < num_simplices; ++index) {
+        auto vertices = simplices[dim].begin() + index * (dim + 1);
+        for (int i = 0; i <= dim; ++i) {
+          facet.assign(vertices, vertices + i);
+          facet.insert(facet.end(), vertices + i + 1, vertices + dim + 1);
+          boundaries[dim].push_back(find_simplex(simplices[dim - 1], dim, facet));
+        }
+      }
+    }
+    // --------------------------------------------------------------------------------------------
+
+    // --------------------------------------------------------------------------------------------
+    // Filtration values, as for a SimplicialComplexForAlpha
+    std::vector<std::vector<Filtration_value>> filtrations(max_dim + 1);
+    std::vector<std::size_t> nan_simplices;
+    std::vector<Filtration_value> alpha_values;
+    Is_Gabriel is_gabriel = kernel_.side_of_bounded_sphere_d_object();
+    Vector_of_CGAL_points pointVector;
+    // ### For i : d -> 0
+    for (int decr_dim = max_dim; decr_dim >= 0; decr_dim--) {
+      std::size_t num_simplices = simplices[decr_dim].size() / (decr_dim + 1);
+      std::vector<Filtration_value>& filtration = filtrations[decr_dim];
+      if (decr_dim == max_dim) filtration.assign(num_simplices, std::numeric_limits<Filtration_value>::quiet_NaN());
+      // ### Foreach Sigma of dim i, if filt(Sigma) is NaN : filt(Sigma) = alpha(Sigma)
+      nan_simplices.clear();
+      for (std::size_t index = 0; index < num_simplices; ++index) {
+        if (std::isnan(filtration[index])) nan_simplices.push_back(index);
+      }
+      alpha_values.assign(nan_simplices.size(), 0.);
+      // No need to compute squared_radius on a single point - alpha is 0.0
+      if (decr_dim > 0) {
+        compute_alpha_values([&](std::size_t index, Vector_of_CGAL_points& points) {
+          // In decreasing order of the vertices, as a Simplex_tree gives them, for the same rounding
+          auto vertices = simplices[decr_dim].begin() + nan_simplices[index] * (decr_dim + 1);
+          for (int i = decr_dim; i >= 0; --i) points.push_back(get_point(vertices[i]));
+        }, alpha_values);
+      }
+      for (std::size_t i = 0; i < nan_simplices.size(); ++i) {
+        filtration[nan_simplices[i]] = alpha_values[i];
+      }
+      if (decr_dim == 0) break;
+      std::vector<Filtration_value>& facet_filtration = filtrations[decr_dim - 1];
+      facet_filtration.assign(simplices[decr_dim - 1].size() / decr_dim,
+                              std::numeric_limits<Filtration_value>::quiet_NaN());
+      // No need to propagate further, unweighted points all have value 0
+      if (decr_dim == 1) continue;
+      // ### Foreach Tau face of Sigma
+      for (std::size_t index = 0; index < num_simplices; ++index) {
+        auto vertices = simplices[decr_dim].begin() + index * (decr_dim + 1);
+        for (int i = 0; i <= decr_dim; ++i) {
+          Filtration_value& tau_filtration = facet_filtration[boundaries[decr_dim][index * (decr_dim + 1) + i]];
+          if (!std::isnan(tau_filtration)) {
+            // ### filt(Tau) = fmin(filt(Tau), filt(Sigma))
+            tau_filtration = fmin(tau_filtration, filtration[index]);
+          } else {
+            // The Sigma point that is not part of Tau is the i-th one
+            pointVector.clear();
+            for (int j = decr_dim; j >= 0; --j) {
+              if (j != i) pointVector.push_back(get_point(vertices[j]));
+            }
+            // ### If Tau is not Gabriel of Sigma : filt(Tau) = filt(Sigma)
+            if (is_gabriel(pointVector.begin(), pointVector.end(), get_point(vertices[i])) == CGAL::ON_BOUNDED_SIDE)
+              tau_filtration = filtration[index];
+          }
+        }
+      }
+    }
+    // As Alpha value is an approximation, we have to make filtration non decreasing while increasing the dimension
+    for (int dim = 1; dim <= max_dim; ++dim) {
+      for (std::size_t index = 0; index < filtrations[dim].size(); ++index) {
+        for (int i = 0; i <= dim; ++i) {
+          filtrations[dim][index] = (std::max)(filtrations[dim][index],
+                                               filtrations[dim - 1][boundaries[dim][index * (dim + 1) + i]]);
+        }
+      }
+    }
+    // --------------------------------------------------------------------------------------------
+
+    // --------------------------------------------------------------------------------------------
+    // Sort the simplices that are not above max_alpha_square in the order of the filtration
+    std::vector<std::pair<int, std::size_t>> order;
+    for (int dim = 0; dim <= max_dim; ++dim) {
+      for (std::size_t index = 0; index < filtrations[dim].size(); ++index) {
+        if (filtrations[dim][index] <= max_alpha_square) order.emplace_back(dim, index);
+      }
+    }
+    std::sort(order.begin(), order.end(),
+              [&](const std::pair<int, std::size_t>& s1, const std::pair<int, std::size_t>& s2) {
+                Filtration_value f1 = filtrations[s1.first][s1.second];
+                Filtration_value f2 = filtrations[s2.first][s2.second];
+                return f1 < f2 || (f1 == f2 && s1 < s2);
+              });
+    std::vector<std::vector<Simplex_handle>> handles(max_dim + 1);
+    for (int dim = 0; dim <= max_dim; ++dim) handles[dim].resize(filtrations[dim].size());
+    for (std::size_t key = 0; key < order.size(); ++key) {
+      handles[order[key].first][order[key].second] = static_cast<Simplex_handle>(key);
+    }
+    complex.reserve(order.size());
+    std::vector<Simplex_handle> boundary;
+    for (std::size_t key = 0; key < order.size(); ++key) {
+      int dim = order[key].first;
+      std::size_t index = order[key].second;
+      // Facets have a lower filtration value, they are not pruned
+      boundary.clear();
+      if (dim > 0) {
+        for (int i = 0; i <= dim; ++i) boundary.push_back(handles[dim - 1][boundaries[dim][index * (dim + 1) + i]]);
+      }
+      complex.insert_simplex(boundary, filtrations[dim][index]);
+    }
+    // --------------------------------------------------------------------------------------------
+    return true;
+  }
+
  private:
+  // Sorts in lexicographic order and removes the duplicates of a list of simplices of width vertices each
+  static void sort_unique_simplices(std::vector<Point_index>& simplices, std::size_t width) {
+    std::vector<std::size_t> order(simplices.size() / width);
+    std::iota(order.begin(), order.end(), 0);
+    auto begin = simplices.cbegin();
+    std::sort(order.begin(), order.end(), [&](std::size_t s1, std::size_t s2) {
+      return std::lexicographical_compare(begin + s1 * width, begin + (s1 + 1) * width,
+                                          begin + s2 * width, begin + (s2 + 1) * width);
+    });
+    std::vector<Point_index> sorted;
+    sorted.reserve(simplices.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      if (i == 0 || !std::equal(begin + order[i - 1] * width, begin + (order[i - 1] + 1) * width,
+                                begin + order[i] * width))
+        sorted.insert(sorted.end(), begin + order[i] * width, begin + (order[i] + 1) * width);
+    }
+    simplices.swap(sorted);
+  }
+
+  // Index of a simplex in a sorted list of simplices of width vertices each
+  static std::size_t find_simplex(const std::vector<Point_index>& simplices, std::size_t width,
+                                  const std::vector<Point_index>& simplex) {
+    std::size_t first = 0;
+    std::size_t last = simplices.size() / width;
+    while (first < last) {
+      std::size_t middle = first + (last - first) / 2;
+      if (std::lexicographical_compare(simplices.begin() + middle * width, simplices.begin() + (middle + 1) * width,
+                                       simplex.begin(), simplex.end()))
+        first = middle + 1;
+      else
+        last = middle;
+    }
+    GUDHI_CHECK(first < simplices.size() / width &&
+                std::equal(simplex.begin(), simplex.end(), simplices.begin() + first * width),
+                std::logic_error("Alpha_complex create_complex - facet not found"));
+    return first;
+  }
+
+ private:
+  /** \brief Computes the alpha values of alpha_values.size() simplices, whose points are given by
+   * fill_points(index, pointVector). In parallel with TBB, each part of the range having its own kernel and point
+   * vector, but only for floating point number types: lazy exact numbers, as the ones of CGAL::Epeck_d, share
+   * reference counted representations that are not thread safe, and are computed sequentially.*/
+  template <typename Fill_points, typename Filtration_value>
+  void compute_alpha_values(Fill_points fill_points, std::vector<Filtration_value>& alpha_values) const {
+    auto compute_range = [&](std::size_t begin, std::size_t end) {
+      Kernel kernel(kernel_);
+      // squared_radius function initialization
+      Squared_Radius squared_radius = kernel.compute_squared_radius_d_object();
+      CGAL::NT_converter<typename Geom_traits::FT, Filtration_value> cv;
+      // Will be re-used many times
+      Vector_of_CGAL_points pointVector;
+      for (std::size_t index = begin; index < end; ++index) {
+        pointVector.clear();
+        fill_points(index, pointVector);
+        alpha_values[index] = cv(squared_radius(pointVector.begin(), pointVector.end()));
+      }
+    };
+#ifdef GUDHI_USE_TBB
+    if (std::is_floating_point<typename Geom_traits::FT>::value) {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, alpha_values.size()),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+        compute_range(range.begin(), range.end());
+      });
+      return;
+    }
+#endif  // GUDHI_USE_TBB
+    compute_range(0, alpha_values.size());
+  }
+
   template <typename SimplicialComplexForAlpha, typename Simplex_handle>
   void propagate_alpha_filtration(SimplicialComplexForAlpha& complex, Simplex_handle f_simplex) {
     // From SimplicialComplexForAlpha type required to assign filtration values.
@@ -33,12 +33,18 @@
 #include <CGAL/Object.h>
 #include <CGAL/tuple.h>
 #include <CGAL/iterator.h>
+#include <CGAL/tags.h>  // for CGAL::Sequential_tag and CGAL::Parallel_tag
 #include <CGAL/version.h>  // for CGAL_VERSION_NR
 
 #include <Eigen/src/Core/util/Macros.h>  // for EIGEN_VERSION_AT_LEAST
 
 #include <boost/container/static_vector.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 #include <iostream>
 #include <vector>
 #include <unordered_map>
@@ -106,6 +112,11 @@ struct Value_from_iterator<complexity::EXACT> {
  *
  * \tparam Periodic Boolean used to set/unset the periodic version of Alpha_complex_3d. Default value is false.
  *
+ * \tparam Concurrency_tag enables sequential versus parallel construction. Possible values are `CGAL::Sequential_tag`
+ * (the default) and `CGAL::Parallel_tag`, which requires CGAL to be linked with TBB (`CGAL_LINKED_WITH_TBB`) and is not
+ * available for the periodic versions. With `CGAL::Parallel_tag`, the points are inserted concurrently in the
+ * triangulation, and the vertex numbering in the simplicial complex may vary from one run to another.
+ *
  * For the weighted version, weights values are explained on CGAL
  * <a href="https://doc.cgal.org/latest/Alpha_shapes_3/index.html#title0">Alpha shapes 3d</a> and
  * <a href="https://doc.cgal.org/latest/Triangulation_3/index.html#Triangulation3secclassRegulartriangulation">Regular
@@ -123,8 +134,15 @@ struct Value_from_iterator<complexity::EXACT> {
  * 3d Delaunay complex.
  *
  */
-template <complexity Complexity = complexity::SAFE, bool Weighted = false, bool Periodic = false>
+template <complexity Complexity = complexity::SAFE, bool Weighted = false, bool Periodic = false,
+          typename Concurrency_tag = CGAL::Sequential_tag>
 class Alpha_complex_3d {
+  static constexpr bool Parallel = std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value;
+  static_assert(!(Parallel && Periodic), "Periodic versions of Alpha_complex_3d cannot be built in parallel");
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!Parallel, "Parallel version of Alpha_complex_3d requires CGAL to be linked with TBB");
+#endif  // CGAL_LINKED_WITH_TBB
+
   // Epick = Exact_predicates_inexact_constructions_kernel
   // Epeck = Exact_predicates_exact_constructions_kernel
   // Exact_alpha_comparison_tag = exact version of CGAL Alpha_shape_3 and of its objects (Alpha_shape_vertex_base_3 and
@@ -177,7 +195,7 @@ class Alpha_complex_3d {
                                         CGAL::Triangulation_cell_base_3<Kernel, TdsCb>>::type;
 
   using Cb = CGAL::Alpha_shape_cell_base_3<Kernel, Tcb>;
-  using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb>;
+  using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb, Concurrency_tag>;
 
   // The other way to do a conditional type. Here there 4 possibilities, cannot use std::conditional
   template <typename Kernel, typename Tds, bool Weighted_version, bool Periodic_version>
@@ -276,8 +294,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
   Alpha_complex_3d(const InputPointRange& points) {
     static_assert(!Periodic, "This constructor is not available for periodic versions of Alpha_complex_3d");
 
-    alpha_shape_3_ptr_ = std::unique_ptr<Alpha_shape_3>(
-        new Alpha_shape_3(std::begin(points), std::end(points), 0, Alpha_shape_3::GENERAL));
+    init_from_range(std::begin(points), std::end(points), Concurrency_tag());
   }
 
   /** \brief Alpha_complex constructor from a list of points and associated weights.
@@ -310,8 +327,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
       index++;
     }
 
-    alpha_shape_3_ptr_ = std::unique_ptr<Alpha_shape_3>(
-        new Alpha_shape_3(std::begin(weighted_points_3), std::end(weighted_points_3), 0, Alpha_shape_3::GENERAL));
+    init_from_range(std::begin(weighted_points_3), std::end(weighted_points_3), Concurrency_tag());
   }
 
   /** \brief Alpha_complex constructor from a list of points and an iso-cuboid coordinates.
@@ -473,82 +489,78 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
 #ifdef DEBUG_TRACES
     std::cout << "filtration_with_alpha_values returns : " << objects.size() << " objects" << std::endl;
 #endif  // DEBUG_TRACES
+    GUDHI_CHECK(objects.size() == alpha_values.size(), "CGAL provided a different number of simplices and values");
 
     Alpha_shape_simplex_tree_map map_cgal_simplex_tree;
-    using Alpha_value_iterator = typename std::vector<FT>::const_iterator;
-    Alpha_value_iterator alpha_value_iterator = alpha_values.begin();
-    for (auto object_iterator : objects) {
-      Vertex_list vertex_list;
-
-      // Retrieve Alpha shape vertex list from object
-      if (const Cell_handle* cell = CGAL::object_cast<Cell_handle>(&object_iterator)) {
-        for (auto i = 0; i < 4; i++) {
-#ifdef DEBUG_TRACES
-          std::cout << "from cell[" << i << "]=" << (*cell)->vertex(i)->point() << std::endl;
-#endif  // DEBUG_TRACES
-          vertex_list.push_back((*cell)->vertex(i));
+    // Construction of the vectors of simplex_tree vertex from lists of alpha_shapes vertex
+    std::vector<Simplex_tree_vector_vertex> simplices(objects.size());
+#ifdef CGAL_LINKED_WITH_TBB
+    if (Parallel) {
+      // Every vertex is part of the filtration, and is numbered in the filtration order first, so that the
+      // simplices can then be converted concurrently with a read-only map
+      for (const CGAL::Object& object : objects) {
+        if (const Alpha_vertex_handle* vertex = CGAL::object_cast<Alpha_vertex_handle>(&object)) {
+          Complex_vertex_handle vertex_number = map_cgal_simplex_tree.size();
+          map_cgal_simplex_tree.emplace(*vertex, vertex_number);
         }
-#ifdef DEBUG_TRACES
-        count_cells++;
-#endif  // DEBUG_TRACES
-      } else if (const Facet* facet = CGAL::object_cast<Facet>(&object_iterator)) {
-        for (auto i = 0; i < 4; i++) {
-          if ((*facet).second != i) {
-#ifdef DEBUG_TRACES
-            std::cout << "from facet=[" << i << "]" << (*facet).first->vertex(i)->point() << std::endl;
-#endif  // DEBUG_TRACES
-            vertex_list.push_back((*facet).first->vertex(i));
+      }
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, objects.size()),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t index = range.begin(); index != range.end(); ++index) {
+          for (auto the_alpha_shape_vertex : get_vertex_list(objects[index])) {
+            auto the_map_iterator = map_cgal_simplex_tree.find(the_alpha_shape_vertex);
+            GUDHI_CHECK(the_map_iterator != map_cgal_simplex_tree.end(), "CGAL provided a simplex of unknown vertex");
+            simplices[index].push_back(the_map_iterator->second);
           }
         }
+      });
+    } else {
+#endif  // CGAL_LINKED_WITH_TBB
+      for (std::size_t index = 0; index < objects.size(); ++index) {
+        for (auto the_alpha_shape_vertex : get_vertex_list(objects[index])) {
+          auto the_map_iterator = map_cgal_simplex_tree.find(the_alpha_shape_vertex);
+          if (the_map_iterator == map_cgal_simplex_tree.end()) {
+            // alpha shape not found
+            Complex_vertex_handle vertex = map_cgal_simplex_tree.size();
 #ifdef DEBUG_TRACES
-        count_facets++;
+            std::cout << "vertex [" << the_alpha_shape_vertex->point() << "] not found - insert " << vertex
+                      << std::endl;
 #endif  // DEBUG_TRACES
-      } else if (const Edge* edge = CGAL::object_cast<Edge>(&object_iterator)) {
-        for (auto i : {(*edge).second, (*edge).third}) {
+            simplices[index].push_back(vertex);
+            map_cgal_simplex_tree.emplace(the_alpha_shape_vertex, vertex);
+          } else {
+            // alpha shape found
+            Complex_vertex_handle vertex = the_map_iterator->second;
 #ifdef DEBUG_TRACES
-          std::cout << "from edge[" << i << "]=" << (*edge).first->vertex(i)->point() << std::endl;
+            std::cout << "vertex [" << the_alpha_shape_vertex->point() << "] found in " << vertex << std::endl;
 #endif  // DEBUG_TRACES
-          vertex_list.push_back((*edge).first->vertex(i));
+            simplices[index].push_back(vertex);
+          }
         }
-#ifdef DEBUG_TRACES
-        count_edges++;
-#endif  // DEBUG_TRACES
-      } else if (const Alpha_vertex_handle* vertex = CGAL::object_cast<Alpha_vertex_handle>(&object_iterator)) {
-#ifdef DEBUG_TRACES
-        count_vertices++;
-        std::cout << "from vertex=" << (*vertex)->point() << std::endl;
-#endif  // DEBUG_TRACES
-        vertex_list.push_back((*vertex));
       }
-      // Construction of the vector of simplex_tree vertex from list of alpha_shapes vertex
-      Simplex_tree_vector_vertex the_simplex;
-      for (auto the_alpha_shape_vertex : vertex_list) {
-        auto the_map_iterator = map_cgal_simplex_tree.find(the_alpha_shape_vertex);
-        if (the_map_iterator == map_cgal_simplex_tree.end()) {
-          // alpha shape not found
-          Complex_vertex_handle vertex = map_cgal_simplex_tree.size();
-#ifdef DEBUG_TRACES
-          std::cout << "vertex [" << the_alpha_shape_vertex->point() << "] not found - insert " << vertex << std::endl;
-#endif  // DEBUG_TRACES
-          the_simplex.push_back(vertex);
-          map_cgal_simplex_tree.emplace(the_alpha_shape_vertex, vertex);
-        } else {
-          // alpha shape found
-          Complex_vertex_handle vertex = the_map_iterator->second;
+#ifdef CGAL_LINKED_WITH_TBB
+    }
+#endif  // CGAL_LINKED_WITH_TBB
+
+    // Construction of the simplex_tree, in the filtration order
+    // Filtration values are converted sequentially, as it may trigger exact computations that are not thread-safe
+    using Alpha_value_iterator = typename std::vector<FT>::const_iterator;
+    Alpha_value_iterator alpha_value_iterator = alpha_values.begin();
+    for (const Simplex_tree_vector_vertex& the_simplex : simplices) {
 #ifdef DEBUG_TRACES
-          std::cout << "vertex [" << the_alpha_shape_vertex->point() << "] found in " << vertex << std::endl;
-#endif  // DEBUG_TRACES
-          the_simplex.push_back(vertex);
-        }
+      switch (the_simplex.size()) {
+        case 1: count_vertices++; break;
+        case 2: count_edges++; break;
+        case 3: count_facets++; break;
+        default: count_cells++; break;
       }
-      // Construction of the simplex_tree
+#endif  // DEBUG_TRACES
       Filtration_value filtr = Value_from_iterator<Complexity>::perform(alpha_value_iterator);
 
 #ifdef DEBUG_TRACES
       std::cout << "filtration = " << filtr << std::endl;
 #endif  // DEBUG_TRACES
       complex.insert_simplex(the_simplex, static_cast<Filtration_value>(filtr));
-      GUDHI_CHECK(alpha_value_iterator != alpha_values.end(), "CGAL provided more simplices than values");
       ++alpha_value_iterator;
     }
 
@@ -568,6 +580,67 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Point
   }
 
  private:
+  // Retrieve Alpha shape vertex list from a CGAL object of the filtration
+  static Vertex_list get_vertex_list(const CGAL::Object& object) {
+    Vertex_list vertex_list;
+    if (const Cell_handle* cell = CGAL::object_cast<Cell_handle>(&object)) {
+      for (auto i = 0; i < 4; i++) {
+#ifdef DEBUG_TRACES
+        std::cout << "from cell[" << i << "]=" << (*cell)->vertex(i)->point() << std::endl;
+#endif  // DEBUG_TRACES
+        vertex_list.push_back((*cell)->vertex(i));
+      }
+    } else if (const Facet* facet = CGAL::object_cast<Facet>(&object)) {
+      for (auto i = 0; i < 4; i++) {
+        if ((*facet).second != i) {
+#ifdef DEBUG_TRACES
+          std::cout << "from facet=[" << i << "]" << (*facet).first->vertex(i)->point() << std::endl;
+#endif  // DEBUG_TRACES
+          vertex_list.push_back((*facet).first->vertex(i));
+        }
+      }
+    } else if (const Edge* edge = CGAL::object_cast<Edge>(&object)) {
+      for (auto i : {(*edge).second, (*edge).third}) {
+#ifdef DEBUG_TRACES
+        std::cout << "from edge[" << i << "]=" << (*edge).first->vertex(i)->point() << std::endl;
+#endif  // DEBUG_TRACES
+        vertex_list.push_back((*edge).first->vertex(i));
+      }
+    } else if (const Alpha_vertex_handle* vertex = CGAL::object_cast<Alpha_vertex_handle>(&object)) {
+#ifdef DEBUG_TRACES
+      std::cout << "from vertex=" << (*vertex)->point() << std::endl;
+#endif  // DEBUG_TRACES
+      vertex_list.push_back((*vertex));
+    }
+    return vertex_list;
+  }
+
+  template <typename InputIterator>
+  void init_from_range(InputIterator first, InputIterator last, CGAL::Sequential_tag) {
+    alpha_shape_3_ptr_ = std::unique_ptr<Alpha_shape_3>(new Alpha_shape_3(first, last, 0, Alpha_shape_3::GENERAL));
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template <typename InputIterator>
+  void init_from_range(InputIterator first, InputIterator last, CGAL::Parallel_tag) {
+    Dt dt;
+    if (first != last) {
+      // The lock grid covers the bounding box of the points
+      auto construct_point = Kernel().construct_point_3_object();
+      CGAL::Bbox_3 bbox = construct_point(*first).bbox();
+      for (InputIterator it = first; it != last; ++it) bbox += construct_point(*it).bbox();
+      typename Dt::Lock_data_structure lock_ds(bbox, 50);
+      dt.set_lock_data_structure(&lock_ds);
+      // Points are spatially sorted, then inserted concurrently
+      dt.insert(first, last);
+      // The lock grid is not needed anymore, as the triangulation won't be modified
+      dt.set_lock_data_structure(nullptr);
+    }
+    // Swaps the triangulation into the alpha shape
+    alpha_shape_3_ptr_ = std::unique_ptr<Alpha_shape_3>(new Alpha_shape_3(dt, 0, Alpha_shape_3::GENERAL));
+  }
+#endif  // CGAL_LINKED_WITH_TBB
+
   // use of a unique_ptr on cgal Alpha_shape_3, as copy and default constructor is not available - no need to be freed
   std::unique_ptr<Alpha_shape_3> alpha_shape_3_ptr_;
 };
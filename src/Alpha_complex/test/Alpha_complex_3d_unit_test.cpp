@@ -18,6 +18,8 @@
 #include <vector>
 #include <random>
 #include <cstddef>  // for std::size_t
+#include <algorithm>  // for std::sort
+#include <utility>  // for std::pair
 
 #include <gudhi/Alpha_complex_3d.h>
 #include <gudhi/graph_simplicial_complex.h>
@@ -150,3 +152,67 @@ BOOST_AUTO_TEST_CASE(Alpha_complex_3d_from_points) {
     ++safe_sh;
   }
 }
+
+#ifdef CGAL_LINKED_WITH_TBB
+using Fast_parallel_alpha_complex_3d =
+    Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, false, false, CGAL::Parallel_tag>;
+
+// Sorted filtration values by dimension, as the vertex numbering depends on the construction
+std::vector<std::pair<int, double>> sorted_filtration_values(Gudhi::Simplex_tree<>& stree) {
+  std::vector<std::pair<int, double>> values;
+  for (auto sh : stree.complex_simplex_range()) {
+    values.emplace_back(stree.dimension(sh), stree.filtration(sh));
+  }
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+BOOST_AUTO_TEST_CASE(Alpha_complex_3d_parallel) {
+  using Creator = CGAL::Creator_uniform_3<double, Fast_alpha_complex_3d::Point_3>;
+  CGAL::Random random(7);
+  CGAL::Random_points_in_cube_3<Fast_alpha_complex_3d::Point_3, Creator> in_cube(1, random);
+  std::vector<Fast_alpha_complex_3d::Point_3> points;
+
+  for (int i = 0; i < 5000; i++) {
+    points.push_back(*in_cube++);
+  }
+
+  // -----------------
+  // Fast version
+  // -----------------
+  std::cout << "Fast alpha complex 3d" << std::endl;
+
+  Fast_alpha_complex_3d alpha_complex(points);
+
+  Gudhi::Simplex_tree<> stree;
+  alpha_complex.create_complex(stree);
+
+  // -----------------
+  // Fast parallel version
+  // -----------------
+  std::cout << "Fast parallel alpha complex 3d" << std::endl;
+
+  Fast_parallel_alpha_complex_3d parallel_alpha_complex(points);
+
+  Gudhi::Simplex_tree<> parallel_stree;
+  parallel_alpha_complex.create_complex(parallel_stree);
+
+  // ---------------------
+  // Compare both versions
+  // ---------------------
+  std::cout << "Parallel Alpha complex 3d num_simplices " << parallel_stree.num_simplices() << " - Fast is "
+            << stree.num_simplices() << std::endl;
+  BOOST_CHECK(parallel_stree.num_simplices() == stree.num_simplices());
+  BOOST_CHECK(parallel_stree.num_vertices() == stree.num_vertices());
+  BOOST_CHECK(parallel_stree.dimension() == stree.dimension());
+
+  auto values = sorted_filtration_values(stree);
+  auto parallel_values = sorted_filtration_values(parallel_stree);
+  BOOST_CHECK(parallel_values.size() == values.size());
+  for (std::size_t i = 0; i < values.size() && i < parallel_values.size(); i++) {
+    BOOST_CHECK(parallel_values[i].first == values[i].first);
+    // Alpha values may be computed from the vertices of a cell in another order
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(parallel_values[i].second, values[i].second, 1e-12);
+  }
+}
+#endif  // CGAL_LINKED_WITH_TBB
@@ -16,15 +16,20 @@
 #include <CGAL/Delaunay_triangulation.h>
 #include <CGAL/Epick_d.h>
 
+#include <algorithm>  // for std::sort
 #include <cmath>  // float comparison
 #include <limits>
+#include <random>
 #include <string>
+#include <utility>  // for std::pair
 #include <vector>
 
 #include <gudhi/Alpha_complex.h>
 // to construct a simplex_tree from Delaunay_triangulation
 #include <gudhi/graph_simplicial_complex.h>
 #include <gudhi/Simplex_tree.h>
+#include <gudhi/Hasse_complex.h>
+#include <gudhi/Persistent_cohomology.h>
 #include <gudhi/Unitary_tests_utils.h>
 
 // Use dynamic_dimension_tag for the user to be able to set dimension
@@ -35,6 +40,10 @@ typedef CGAL::Epick_d< CGAL::Dimension_tag<3> > Kernel_s;
 
 typedef boost::mpl::list<Kernel_d, Kernel_s> list_of_kernel_variants;
 
+template<typename FilteredComplex>
+using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<FilteredComplex,
+                                                                                  Gudhi::persistent_cohomology::Field_Zp>;
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_from_OFF_file, TestedKernel, list_of_kernel_variants) {
   // ----------------------------------------------------------------------------
   //
@@ -269,3 +278,71 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_from_empty_points, TestedKernel, lis
   std::cout << "simplex_tree.num_vertices()=" << simplex_tree.num_vertices() << std::endl;
   BOOST_CHECK(simplex_tree.num_vertices() == 0);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_to_Hasse_complex, TestedKernel, list_of_kernel_variants) {
+  // ----------------------------------------------------------------------------
+  // Init of a list of random points
+  // ----------------------------------------------------------------------------
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> coordinate(-1., 1.);
+  std::vector<typename TestedKernel::Point_d> points;
+  for (int i = 0; i < 100; i++) {
+    std::vector<double> coords = { coordinate(gen), coordinate(gen), coordinate(gen) };
+    points.emplace_back(coords.begin(), coords.end());
+  }
+  Gudhi::alpha_complex::Alpha_complex<TestedKernel> alpha_complex_from_points(points);
+
+  for (double max_alpha_square : {0.05, std::numeric_limits<double>::infinity()}) {
+    Gudhi::Simplex_tree<> simplex_tree;
+    BOOST_CHECK(alpha_complex_from_points.create_complex(simplex_tree, max_alpha_square));
+    Gudhi::Hasse_complex<> hasse_complex;
+    BOOST_CHECK(alpha_complex_from_points.create_complex(hasse_complex, max_alpha_square));
+
+    std::cout << "simplex_tree.num_simplices()=" << simplex_tree.num_simplices()
+        << " - hasse_complex.num_simplices()=" << hasse_complex.num_simplices() << std::endl;
+    BOOST_CHECK(hasse_complex.num_simplices() == simplex_tree.num_simplices());
+    BOOST_CHECK(hasse_complex.dimension() == simplex_tree.dimension());
+
+    // Same simplices up to their vertices, that are not stored by Hasse_complex
+    std::vector<std::pair<int, double>> st_simplices, hasse_simplices;
+    for (auto f_simplex : simplex_tree.filtration_simplex_range())
+      st_simplices.emplace_back(simplex_tree.dimension(f_simplex), simplex_tree.filtration(f_simplex));
+    for (std::size_t sh = 0; sh < hasse_complex.num_simplices(); sh++) {
+      hasse_simplices.emplace_back(hasse_complex.dimension(sh), hasse_complex.filtration(sh));
+      // Filtration order: the faces come first
+      for (auto b_simplex : hasse_complex.boundary_simplex_range(sh)) {
+        BOOST_CHECK(b_simplex < static_cast<int>(sh));
+        BOOST_CHECK(hasse_complex.dimension(b_simplex) == hasse_complex.dimension(sh) - 1);
+        BOOST_CHECK(hasse_complex.filtration(b_simplex) <= hasse_complex.filtration(sh));
+      }
+    }
+    std::sort(st_simplices.begin(), st_simplices.end());
+    std::sort(hasse_simplices.begin(), hasse_simplices.end());
+    BOOST_CHECK(st_simplices == hasse_simplices);
+
+    // Same persistence diagrams, up to the intervals of length 0 that depend on the order of simplices with the same
+    // filtration value
+    Persistent_cohomology<Gudhi::Simplex_tree<>> st_pcoh(simplex_tree);
+    st_pcoh.init_coefficients(2);
+    st_pcoh.compute_persistent_cohomology();
+    Persistent_cohomology<Gudhi::Hasse_complex<>> hasse_pcoh(hasse_complex);
+    hasse_pcoh.init_coefficients(2);
+    hasse_pcoh.compute_persistent_cohomology();
+    for (int dim = 0; dim < simplex_tree.dimension(); dim++) {
+      std::vector<std::pair<double, double>> st_diagram, hasse_diagram;
+      for (auto& interval : st_pcoh.intervals_in_dimension(dim))
+        if (interval.first < interval.second) st_diagram.push_back(interval);
+      for (auto& interval : hasse_pcoh.intervals_in_dimension(dim))
+        if (interval.first < interval.second) hasse_diagram.push_back(interval);
+      std::sort(st_diagram.begin(), st_diagram.end());
+      std::sort(hasse_diagram.begin(), hasse_diagram.end());
+      std::cout << "dimension " << dim << " - " << st_diagram.size() << " intervals" << std::endl;
+      BOOST_CHECK(st_diagram == hasse_diagram);
+    }
+  }
+
+  // A non-empty complex is not modified
+  Gudhi::Hasse_complex<> hasse_complex;
+  BOOST_CHECK(alpha_complex_from_points.create_complex(hasse_complex));
+  BOOST_CHECK(!alpha_complex_from_points.create_complex(hasse_complex));
+}
@@ -97,6 +97,22 @@ class Bitmap_cubical_complex : public T {
     this->initialize_simplex_associated_to_key();
   }
 
+  /**
+   * Constructor that requires vector of elements of type unsigned, which gives number of top dimensional cells
+   * in the following directions and a buffer of elements of type Filtration_value with filtration on top dimensional
+   * cells, in the same order as for the previous constructor. The buffer is not copied.
+   **/
+  Bitmap_cubical_complex(const std::vector<unsigned>& dimensions, const Filtration_value* top_dimensional_cells)
+      : T(dimensions, top_dimensional_cells), key_associated_to_simplex(this->total_number_of_cells + 1) {
+    for (std::size_t i = 0; i != this->total_number_of_cells; ++i) {
+      this->key_associated_to_simplex[i] = i;
+    }
+    // we initialize this only once, in each constructor, when the bitmap is constructed.
+    // If the user decide to change some elements of the bitmap, then this procedure need
+    // to be called again.
+    this->initialize_simplex_associated_to_key();
+  }
+
   /**
    * Constructor that requires vector of elements of type unsigned, which gives number of top dimensional cells
    * in the following directions and vector of element of a type Filtration_value
@@ -13,6 +13,12 @@
 
 #include <gudhi/Bitmap_cubical_complex/counter.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/blocked_range2d.h>
+#endif
+
 #include <iostream>
 #include <vector>
 #include <string>
@@ -75,6 +81,12 @@ class Bitmap_cubical_complex_base {
    * together with vector of filtration values of top dimensional cells.
    **/
   Bitmap_cubical_complex_base(const std::vector<unsigned>& dimensions, const std::vector<T>& top_dimensional_cells);
+  /**
+   * Same as the previous constructor, but the filtration values of the top dimensional cells are read from a buffer,
+   * in the same order, so that large images do not have to be copied to a vector first. The buffer must contain as many
+   * values as the product of the dimensions.
+   **/
+  Bitmap_cubical_complex_base(const std::vector<unsigned>& dimensions, const T* top_dimensional_cells);
 
   /**
    * Destructor of the Bitmap_cubical_complex_base class.
@@ -503,6 +515,9 @@ class Bitmap_cubical_complex_base {
     return counter;
   }
   void read_perseus_style_file(const char* perseus_style_file);
+  void set_top_dimensional_cells(const T* top_dimensional_cells);
+  void lower_star_sweep(std::size_t direction, std::size_t slice_begin, std::size_t slice_end, std::size_t line_begin,
+                        std::size_t line_end);
   void setup_bitmap_based_on_top_dimensional_cells_list(const std::vector<unsigned>& sizes_in_following_directions,
                                                         const std::vector<T>& top_dimensional_cells);
   Bitmap_cubical_complex_base(const char* perseus_style_file, std::vector<bool> directions);
@@ -593,21 +608,53 @@ void Bitmap_cubical_complex_base<T>::setup_bitmap_based_on_top_dimensional_cells
         "sizes_in_following_directions vector is different than the size of top_dimensional_cells vector.");
   }
 
-  Bitmap_cubical_complex_base<T>::Top_dimensional_cells_iterator it(*this);
-  std::size_t index = 0;
-  for (it = this->top_dimensional_cells_iterator_begin(); it != this->top_dimensional_cells_iterator_end(); ++it) {
-    this->get_cell_data(*it) = top_dimensional_cells[index];
-    ++index;
-  }
+  this->set_top_dimensional_cells(top_dimensional_cells.data());
   this->impose_lower_star_filtration();
 }
 
+template <typename T>
+void Bitmap_cubical_complex_base<T>::set_top_dimensional_cells(const T* top_dimensional_cells) {
+  if (this->sizes.empty()) return;
+  // The top dimensional cells have odd coordinates in every direction. They are written line by line, a line being
+  // along the first direction, where they are contiguous in the input and every other cell in the bitmap.
+  std::size_t line_size = this->sizes[0];
+  std::size_t number_of_lines = 1;
+  for (std::size_t i = 1; i != this->sizes.size(); ++i) number_of_lines *= this->sizes[i];
+  auto set_lines = [&](std::size_t line_begin, std::size_t line_end) {
+    for (std::size_t line = line_begin; line != line_end; ++line) {
+      std::size_t position = this->multipliers[0];
+      std::size_t rest = line;
+      for (std::size_t i = 1; i != this->sizes.size(); ++i) {
+        position += (2 * (rest % this->sizes[i]) + 1) * this->multipliers[i];
+        rest /= this->sizes[i];
+      }
+      const T* input = top_dimensional_cells + line * line_size;
+      T* output = this->data.data() + position;
+      for (std::size_t j = 0; j != line_size; ++j) output[2 * j] = input[j];
+    }
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, number_of_lines),
+                    [&](const tbb::blocked_range<std::size_t>& range) { set_lines(range.begin(), range.end()); });
+#else
+  set_lines(0, number_of_lines);
+#endif
+}
+
 template <typename T>
 Bitmap_cubical_complex_base<T>::Bitmap_cubical_complex_base(const std::vector<unsigned>& sizes_in_following_directions,
                                                             const std::vector<T>& top_dimensional_cells) {
   this->setup_bitmap_based_on_top_dimensional_cells_list(sizes_in_following_directions, top_dimensional_cells);
 }
 
+template <typename T>
+Bitmap_cubical_complex_base<T>::Bitmap_cubical_complex_base(const std::vector<unsigned>& dimensions,
+                                                            const T* top_dimensional_cells) {
+  this->set_up_containers(dimensions);
+  this->set_top_dimensional_cells(top_dimensional_cells);
+  this->impose_lower_star_filtration();
+}
+
 template <typename T>
 void Bitmap_cubical_complex_base<T>::read_perseus_style_file(const char* perseus_style_file) {
   bool dbg = false;
@@ -635,11 +682,10 @@ void Bitmap_cubical_complex_base<T>::read_perseus_style_file(const char* perseus
   }
   this->set_up_containers(sizes);
 
-  Bitmap_cubical_complex_base<T>::Top_dimensional_cells_iterator it(*this);
-  it = this->top_dimensional_cells_iterator_begin();
-
-  T filtrationLevel = 0.;
-  std::size_t filtration_counter = 0;
+  // The values are read in the order of the top dimensional cells, and set all at once
+  std::vector<T> top_dimensional_cells;
+  top_dimensional_cells.reserve(dimensions);
+  double filtrationLevel = 0.;
   while (!inFiltration.eof()) {
     std::string line;
     getline(inFiltration, line);
@@ -651,23 +697,21 @@ void Bitmap_cubical_complex_base<T>::read_perseus_style_file(const char* perseus
       }
 
       if (dbg) {
-        std::cerr << "Cell of an index : " << it.compute_index_in_bitmap()
-                  << " and dimension: " << this->get_dimension_of_a_cell(it.compute_index_in_bitmap())
+        std::cerr << "Top dimensional cell number " << top_dimensional_cells.size()
                   << " get the value : " << filtrationLevel << std::endl;
       }
-      this->get_cell_data(*it) = filtrationLevel;
-      ++it;
-      ++filtration_counter;
+      top_dimensional_cells.push_back(filtrationLevel);
     }
   }
 
-  if (filtration_counter != dimensions) {
-    std::string perseus_error("Bad Perseus file format. Read " + std::to_string(filtration_counter) + " expected " + \
-      std::to_string(dimensions) + " values");
+  if (top_dimensional_cells.size() != dimensions) {
+    std::string perseus_error("Bad Perseus file format. Read " + std::to_string(top_dimensional_cells.size()) +
+      " expected " + std::to_string(dimensions) + " values");
     throw std::ios_base::failure(perseus_error.c_str());
   }
 
   inFiltration.close();
+  this->set_top_dimensional_cells(top_dimensional_cells.data());
   this->impose_lower_star_filtration();
 }
 
@@ -782,55 +826,59 @@ inline T& Bitmap_cubical_complex_base<T>::get_cell_data(std::size_t cell) {
 
 template <typename T>
 void Bitmap_cubical_complex_base<T>::impose_lower_star_filtration() {
-  bool dbg = false;
-
-  // this vector will be used to check which elements have already been taken care of in imposing lower star filtration
-  std::vector<bool> is_this_cell_considered(this->data.size(), false);
-
-  std::size_t size_to_reserve = 1;
-  for (std::size_t i = 0; i != this->multipliers.size(); ++i) {
-    size_to_reserve *= (std::size_t)((this->multipliers[i] - 1) / 2);
-  }
-
-  std::vector<std::size_t> indices_to_consider;
-  indices_to_consider.reserve(size_to_reserve);
-  // we assume here that we already have a filtration on the top dimensional cells and
-  // we have to extend it to lower ones.
-  typename Bitmap_cubical_complex_base<T>::Top_dimensional_cells_iterator it(*this);
-  for (it = this->top_dimensional_cells_iterator_begin(); it != this->top_dimensional_cells_iterator_end(); ++it) {
-    indices_to_consider.push_back(it.compute_index_in_bitmap());
+  // The filtration value of a cell is the minimum of the ones of the top dimensional cells containing it, and of its
+  // own value. As cells are products of intervals, this minimum is computed one direction after the other: in the
+  // sweep along a direction, each cell with an even coordinate in this direction (i.e. collapsed in this direction)
+  // takes the minimum of its value and of the ones of its two neighbors in this direction.
+  if (this->data.empty()) return;
+  for (std::size_t direction = 0; direction != this->multipliers.size(); ++direction) {
+    std::size_t line_size = this->multipliers[direction];
+    std::size_t extent = (direction + 1 == this->multipliers.size() ? this->total_number_of_cells
+                                                                   : this->multipliers[direction + 1]) / line_size;
+    std::size_t number_of_slices = this->total_number_of_cells / (line_size * extent);
+#ifdef GUDHI_USE_TBB
+    // Cells are independent within a sweep, the work is split along both the slices and the lines
+    tbb::parallel_for(tbb::blocked_range2d<std::size_t>(0, number_of_slices, 0, line_size),
+                      [&](const tbb::blocked_range2d<std::size_t>& range) {
+                        this->lower_star_sweep(direction, range.rows().begin(), range.rows().end(),
+                                               range.cols().begin(), range.cols().end());
+                      });
+#else
+    this->lower_star_sweep(direction, 0, number_of_slices, 0, line_size);
+#endif
   }
+}
 
-  while (indices_to_consider.size()) {
-    if (dbg) {
-      std::cerr << "indices_to_consider in this iteration \n";
-      for (std::size_t i = 0; i != indices_to_consider.size(); ++i) {
-        std::cout << indices_to_consider[i] << "  ";
-      }
-    }
-    std::vector<std::size_t> new_indices_to_consider;
-    for (std::size_t i = 0; i != indices_to_consider.size(); ++i) {
-      std::vector<std::size_t> bd = this->get_boundary_of_a_cell(indices_to_consider[i]);
-      for (std::size_t boundaryIt = 0; boundaryIt != bd.size(); ++boundaryIt) {
-        if (dbg) {
-          std::cerr << "filtration of a cell : " << bd[boundaryIt] << " is : " << this->data[bd[boundaryIt]]
-                    << " while of a cell: " << indices_to_consider[i] << " is: " << this->data[indices_to_consider[i]]
-                    << std::endl;
-        }
-        if (this->data[bd[boundaryIt]] > this->data[indices_to_consider[i]]) {
-          this->data[bd[boundaryIt]] = this->data[indices_to_consider[i]];
-          if (dbg) {
-            std::cerr << "Setting the value of a cell : " << bd[boundaryIt]
-                      << " to : " << this->data[indices_to_consider[i]] << std::endl;
-          }
-        }
-        if (is_this_cell_considered[bd[boundaryIt]] == false) {
-          new_indices_to_consider.push_back(bd[boundaryIt]);
-          is_this_cell_considered[bd[boundaryIt]] = true;
-        }
+template <typename T>
+void Bitmap_cubical_complex_base<T>::lower_star_sweep(std::size_t direction, std::size_t slice_begin,
+                                                      std::size_t slice_end, std::size_t line_begin,
+                                                      std::size_t line_end) {
+  // A slice is made of the cells with the same coordinates in the next directions, a line of the cells with the same
+  // coordinates in all directions but the previous ones
+  std::size_t line_size = this->multipliers[direction];
+  std::size_t extent = (direction + 1 == this->multipliers.size() ? this->total_number_of_cells
+                                                                 : this->multipliers[direction + 1]) / line_size;
+  // With periodic boundary conditions, there are as many vertices as edges in the direction
+  bool periodic = (extent % 2 == 0);
+  for (std::size_t slice = slice_begin; slice != slice_end; ++slice) {
+    T* slice_data = this->data.data() + slice * extent * line_size;
+    for (std::size_t coordinate = 0; coordinate < extent; coordinate += 2) {
+      T* cell = slice_data + coordinate * line_size;
+      const T* previous = nullptr;
+      if (coordinate != 0)
+        previous = cell - line_size;
+      else if (periodic)
+        previous = slice_data + (extent - 1) * line_size;
+      const T* next = (coordinate + 1 < extent) ? cell + line_size : nullptr;
+      if (previous != nullptr && next != nullptr) {
+        for (std::size_t i = line_begin; i != line_end; ++i)
+          cell[i] = (std::min)(cell[i], (std::min)(previous[i], next[i]));
+      } else if (previous != nullptr || next != nullptr) {
+        const T* neighbor = (previous != nullptr) ? previous : next;
+        for (std::size_t i = line_begin; i != line_end; ++i)
+          cell[i] = (std::min)(cell[i], neighbor[i]);
       }
     }
-    indices_to_consider.swap(new_indices_to_consider);
   }
 }
 
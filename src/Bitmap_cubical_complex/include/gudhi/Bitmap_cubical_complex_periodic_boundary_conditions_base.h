@@ -187,11 +187,7 @@ void Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::construct_comp
   this->directions_in_which_periodic_b_cond_are_to_be_imposed = directions_in_which_periodic_b_cond_are_to_be_imposed;
   this->set_up_containers(dimensions);
 
-  std::size_t i = 0;
-  for (auto it = this->top_dimensional_cells_iterator_begin(); it != this->top_dimensional_cells_iterator_end(); ++it) {
-    this->get_cell_data(*it) = topDimensionalCells[i];
-    ++i;
-  }
+  this->set_top_dimensional_cells(topDimensionalCells.data());
   this->impose_lower_star_filtration();
 }
 
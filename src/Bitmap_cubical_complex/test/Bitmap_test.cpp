@@ -1579,3 +1579,27 @@ BOOST_AUTO_TEST_CASE(perseus_file_read) {
   std::cout << "Second value of sinusoid.txt is " << value << std::endl;
   BOOST_CHECK(value == std::numeric_limits<double>::infinity());
 }
+
+BOOST_AUTO_TEST_CASE(top_dimensional_cells_buffer) {
+  std::vector<unsigned> dimensions({4, 3, 5});
+  std::vector<double> top_dimensional_cells;
+  for (unsigned i = 0; i != 4 * 3 * 5; ++i) top_dimensional_cells.push_back((i * 37) % 11);
+
+  Bitmap_cubical_complex from_vector(dimensions, top_dimensional_cells);
+  Bitmap_cubical_complex from_buffer(dimensions, top_dimensional_cells.data());
+  BOOST_CHECK(from_buffer.size() == from_vector.size());
+
+  auto it = from_buffer.top_dimensional_cells_iterator_begin();
+  for (std::size_t i = 0; i != top_dimensional_cells.size(); ++i, ++it) {
+    BOOST_CHECK(from_buffer.get_cell_data(*it) == top_dimensional_cells[i]);
+  }
+  // Lower star filtration: every cell which is not top dimensional gets the minimum of its cofaces
+  for (std::size_t cell = 0; cell != from_buffer.size(); ++cell) {
+    BOOST_CHECK(from_buffer.get_cell_data(cell) == from_vector.get_cell_data(cell));
+    if (from_buffer.get_dimension_of_a_cell(cell) == 3) continue;
+    double minimum = std::numeric_limits<double>::infinity();
+    for (auto coface : from_buffer.get_coboundary_of_a_cell(cell))
+      minimum = std::min(minimum, from_buffer.get_cell_data(coface));
+    BOOST_CHECK(from_buffer.get_cell_data(cell) == minimum);
+  }
+}
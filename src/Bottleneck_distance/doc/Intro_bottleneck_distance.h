@@ -61,6 +61,18 @@ int main() {
  *
  * \image html bottleneck_distance_example.png The point (0, 13) is at distance 6.5 from the diagonal and more specifically from the point (6.5, 6.5)
  *
+ * To compare many persistence diagrams, `bottleneck_distance_matrix()` computes the distances between all the pairs of
+ * a range of diagrams. Each diagram is preprocessed only once, and the pairs are processed in parallel if TBB is
+ * available.
+ *
+ * \section wassersteindistance Wasserstein distance
+ *
+ * The Wasserstein distance of order \f$q \geq 1\f$ replaces the length of the longest edge of the matching by the
+ * \f$q\f$-th root of the sum of the \f$q\f$-th powers of the lengths of the edges, still measured with the sup norm.
+ * `wasserstein_distance()`, from `gudhi/Wasserstein.h`, computes it up to a relative error with an auction algorithm
+ * as described in "Geometry Helps to Compare Persistence Diagrams" \cite Kerber:2017:GHC:3047249.3064175, and does
+ * not require CGAL.
+ *
  * \section bottleneckbasicexample Basic example
  *
  * This other example computes the bottleneck distance from 2 persistence diagrams:
@@ -0,0 +1,194 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef AUCTION_NEIGHBORS_FINDER_H_
+#define AUCTION_NEIGHBORS_FINDER_H_
+
+#include <gudhi/Internal_point.h>
+
+#include <vector>
+#include <algorithm>  // for std::nth_element, std::min, std::max
+#include <limits>  // for numeric_limits
+#include <cmath>  // for std::pow, std::fabs
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief Cost of a matching edge of (L-infinity) length distance, for the order of the Wasserstein
+ * distance. */
+inline double wasserstein_cost(double distance, double order) {
+  if (order == 1.)
+    return distance;
+  if (order == 2.)
+    return distance * distance;
+  return std::pow(distance, order);
+}
+
+/** \internal \brief Data structure used by the auction algorithm to find the two items of lowest cost for a bidder,
+ * the cost of an item being its price plus the power of its distance to the bidder.
+ *
+ * The items are stored in a kd-tree where each node knows the lowest price of its subtree, so that the search
+ * discards the subtrees that cannot contain one of the two best items. Prices only increase.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Auction_neighbors_finder {
+ public:
+  /** \internal \brief Constructor taking the items, with a null price, and the order of the Wasserstein distance. */
+  Auction_neighbors_finder(const std::vector<Internal_point>& items, double order);
+  /** \internal \brief Returns the price of an item. */
+  double price(int item) const;
+  /** \internal \brief Sets the price of an item, that must not be lower than its current price. */
+  void set_price(int item, double price);
+  /** \internal \brief Finds the item of lowest cost for the query point, and the two lowest costs. best is -1 if there
+   * is no item. */
+  void best_two(const Internal_point& query, int& best, double& best_cost, double& second_cost) const;
+
+ private:
+  static const int leaf_size = 8;
+
+  struct Node {
+    double min_x, max_x, min_y, max_y;
+    double min_price;
+    int begin, end;  // range in items_
+    int left, right, parent;  // -1 when none
+  };
+
+  int build(int begin, int end, int parent, bool split_on_x);
+  void update_min_price(int node);
+  double lower_bound(int node, const Internal_point& query) const;
+  void search(int node, double node_lower_bound, const Internal_point& query, int& best, double& best_cost,
+              double& second_cost) const;
+
+  std::vector<Internal_point> items_;  // permuted by the kd-tree, point_index is the item number
+  std::vector<double> prices_;  // by item number
+  std::vector<int> leaf_of_;  // by item number
+  std::vector<Node> nodes_;
+  double order_;
+};
+
+inline Auction_neighbors_finder::Auction_neighbors_finder(const std::vector<Internal_point>& items, double order)
+    : items_(items), prices_(items.size(), 0.), leaf_of_(items.size()), order_(order) {
+  if (!items_.empty())
+    build(0, static_cast<int> (items_.size()), -1, true);
+}
+
+inline int Auction_neighbors_finder::build(int begin, int end, int parent, bool split_on_x) {
+  int node = static_cast<int> (nodes_.size());
+  nodes_.push_back(Node());
+  Node n;
+  n.min_x = n.min_y = std::numeric_limits<double>::infinity();
+  n.max_x = n.max_y = -std::numeric_limits<double>::infinity();
+  for (int i = begin; i < end; ++i) {
+    n.min_x = (std::min)(n.min_x, items_[i].x());
+    n.max_x = (std::max)(n.max_x, items_[i].x());
+    n.min_y = (std::min)(n.min_y, items_[i].y());
+    n.max_y = (std::max)(n.max_y, items_[i].y());
+  }
+  n.min_price = 0.;
+  n.begin = begin;
+  n.end = end;
+  n.left = n.right = -1;
+  n.parent = parent;
+  if (end - begin <= leaf_size) {
+    for (int i = begin; i < end; ++i)
+      leaf_of_[items_[i].point_index] = node;
+    nodes_[node] = n;
+    return node;
+  }
+  int middle = begin + (end - begin) / 2;
+  std::nth_element(items_.begin() + begin, items_.begin() + middle, items_.begin() + end,
+                   [split_on_x](const Internal_point& p1, const Internal_point& p2) {
+                     return split_on_x ? p1.x() < p2.x() : p1.y() < p2.y();
+                   });
+  nodes_[node] = n;
+  // nodes_ may be reallocated by the recursive calls
+  int left = build(begin, middle, node, !split_on_x);
+  int right = build(middle, end, node, !split_on_x);
+  nodes_[node].left = left;
+  nodes_[node].right = right;
+  return node;
+}
+
+inline double Auction_neighbors_finder::price(int item) const {
+  return prices_[item];
+}
+
+inline void Auction_neighbors_finder::set_price(int item, double price) {
+  prices_[item] = price;
+  update_min_price(leaf_of_[item]);
+}
+
+inline void Auction_neighbors_finder::update_min_price(int node) {
+  for (; node != -1; node = nodes_[node].parent) {
+    Node& n = nodes_[node];
+    double min_price = std::numeric_limits<double>::infinity();
+    if (n.left == -1) {
+      for (int i = n.begin; i < n.end; ++i)
+        min_price = (std::min)(min_price, prices_[items_[i].point_index]);
+    } else {
+      min_price = (std::min)(nodes_[n.left].min_price, nodes_[n.right].min_price);
+    }
+    if (min_price == n.min_price)
+      return;  // ancestors are unchanged
+    n.min_price = min_price;
+  }
+}
+
+inline void Auction_neighbors_finder::best_two(const Internal_point& query, int& best, double& best_cost,
+                                               double& second_cost) const {
+  best = -1;
+  best_cost = second_cost = std::numeric_limits<double>::infinity();
+  if (!nodes_.empty())
+    search(0, lower_bound(0, query), query, best, best_cost, second_cost);
+}
+
+inline double Auction_neighbors_finder::lower_bound(int node, const Internal_point& query) const {
+  const Node& n = nodes_[node];
+  double distance = (std::max)((std::max)(n.min_x - query.x(), query.x() - n.max_x),
+                               (std::max)(n.min_y - query.y(), query.y() - n.max_y));
+  return wasserstein_cost((std::max)(distance, 0.), order_) + n.min_price;
+}
+
+inline void Auction_neighbors_finder::search(int node, double node_lower_bound, const Internal_point& query,
+                                             int& best, double& best_cost, double& second_cost) const {
+  if (node_lower_bound >= second_cost)
+    return;
+  const Node& n = nodes_[node];
+  if (n.left == -1) {
+    for (int i = n.begin; i < n.end; ++i) {
+      const Internal_point& item = items_[i];
+      double cost = wasserstein_cost((std::max)(std::fabs(item.x() - query.x()), std::fabs(item.y() - query.y())),
+                                     order_) + prices_[item.point_index];
+      if (cost < best_cost) {
+        second_cost = best_cost;
+        best_cost = cost;
+        best = item.point_index;
+      } else if (cost < second_cost) {
+        second_cost = cost;
+      }
+    }
+    return;
+  }
+  // The most promising child first, for the bound to be tight earlier
+  double left_bound = lower_bound(n.left, query);
+  double right_bound = lower_bound(n.right, query);
+  if (left_bound <= right_bound) {
+    search(n.left, left_bound, query, best, best_cost, second_cost);
+    search(n.right, right_bound, query, best, best_cost, second_cost);
+  } else {
+    search(n.right, right_bound, query, best, best_cost, second_cost);
+    search(n.left, left_bound, query, best, best_cost, second_cost);
+  }
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // AUCTION_NEIGHBORS_FINDER_H_
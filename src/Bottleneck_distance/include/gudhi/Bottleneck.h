@@ -17,9 +17,14 @@
 
 #include <CGAL/version.h>  // for CGAL_VERSION_NR
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <vector>
 #include <algorithm>  // for max
 #include <limits>  // for numeric_limits
+#include <random>  // for std::mt19937
 
 #include <cmath>
 #include <cfloat>  // FLT_EVAL_METHOD
@@ -38,7 +43,7 @@ inline double bottleneck_distance_approx(Persistence_graph& g, double e) {
   double b_upper_bound = g.diameter_bound();
   const double alpha = std::pow(g.size(), 1. / 5.);
   Graph_matching m(g);
-  Graph_matching biggest_unperfect(g);
+  Graph_matching biggest_unperfect(m);  // shares the kd-tree of m
   while (b_upper_bound - b_lower_bound > 2 * e) {
     double step = b_lower_bound + (b_upper_bound - b_lower_bound) / alpha;
 #if !defined FLT_EVAL_METHOD || FLT_EVAL_METHOD < 0 || FLT_EVAL_METHOD > 1
@@ -64,12 +69,49 @@ inline double bottleneck_distance_approx(Persistence_graph& g, double e) {
 }
 
 inline double bottleneck_distance_exact(Persistence_graph& g) {
-  std::vector<double> sd = g.sorted_distances();
+  // The O(n^2) distances are not stored: the interval (lower, upper) where the result lies is narrowed with randomly
+  // picked distances, and only the few distances left in it are sorted for the binary search
+  const std::size_t max_sorted_distances = 4 * static_cast<std::size_t> (g.size()) + 64;
+  double lower = -std::numeric_limits<double>::infinity();  // no perfect matching up to lower
+  double upper = std::numeric_limits<double>::infinity();  // a perfect matching from upper
+  std::mt19937 gen(0);  // the result does not depend on the seed
+  Graph_matching m(g);
+  Graph_matching biggest_unperfect(m);  // shares the kd-tree of m
+  while (true) {
+    std::size_t count = 0;
+    g.for_each_distance([&](double d) {
+      if (lower < d && d < upper)
+        ++count;
+    });
+    if (count <= max_sorted_distances)
+      break;
+    std::size_t picked = std::uniform_int_distribution<std::size_t>(0, count - 1)(gen);
+    double step = upper;
+    g.for_each_distance([&](double d) {
+      if (lower < d && d < upper && picked-- == 0)
+        step = d;
+    });
+    m.set_r(step);
+    while (m.multi_augment()) {}  // compute a maximum matching (in the graph corresponding to the current r)
+    if (m.perfect()) {
+      m = biggest_unperfect;
+      upper = step;
+    } else {
+      biggest_unperfect = m;
+      lower = step;
+    }
+  }
+  std::vector<double> sd;
+  g.for_each_distance([&](double d) {
+    if (lower < d && d < upper)
+      sd.push_back(d);
+  });
+  if (upper != std::numeric_limits<double>::infinity())
+    sd.push_back(upper);
+  std::sort(sd.begin(), sd.end());
   long lower_bound_i = 0;
   long upper_bound_i = sd.size() - 1;
   const double alpha = std::pow(g.size(), 1. / 5.);
-  Graph_matching m(g);
-  Graph_matching biggest_unperfect(g);
   while (lower_bound_i != upper_bound_i) {
     long step = lower_bound_i + static_cast<long> ((upper_bound_i - lower_bound_i - 1) / alpha);
     m.set_r(sd.at(step));
@@ -85,6 +127,12 @@ inline double bottleneck_distance_exact(Persistence_graph& g) {
   return sd.at(lower_bound_i);
 }
 
+inline double bottleneck_distance_of_graph(Persistence_graph& g, double e) {
+  if (g.bottleneck_alive() == std::numeric_limits<double>::infinity())
+    return std::numeric_limits<double>::infinity();
+  return (std::max)(g.bottleneck_alive(), e == 0. ? bottleneck_distance_exact(g) : bottleneck_distance_approx(g, e));
+}
+
 /** \brief Function to compute the Bottleneck distance between two persistence diagrams.
  *
  * \tparam Persistence_diagram1,Persistence_diagram2
@@ -112,9 +160,51 @@ template<typename Persistence_diagram1, typename Persistence_diagram2>
 double bottleneck_distance(const Persistence_diagram1 &diag1, const Persistence_diagram2 &diag2,
                            double e = (std::numeric_limits<double>::min)()) {
   Persistence_graph g(diag1, diag2, e);
-  if (g.bottleneck_alive() == std::numeric_limits<double>::infinity())
-    return std::numeric_limits<double>::infinity();
-  return (std::max)(g.bottleneck_alive(), e == 0. ? bottleneck_distance_exact(g) : bottleneck_distance_approx(g, e));
+  return bottleneck_distance_of_graph(g, e);
+}
+
+/** \brief Function to compute the Bottleneck distances between all the pairs of a range of persistence diagrams.
+ *
+ * The points of each diagram are filtered and sorted only once, and the distances are computed in parallel if TBB is
+ * available.
+ *
+ * \tparam Persistence_diagram_range
+ * range of models of the concept `PersistenceDiagram`.
+ *
+ * \param[in] diagrams The persistence diagrams.
+ * \param[in] e The approximation parameter, as for `bottleneck_distance()`.
+ *
+ * \return The symmetric matrix of the Bottleneck distances between the diagrams, with zeros on the diagonal.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram_range>
+std::vector<std::vector<double>> bottleneck_distance_matrix(const Persistence_diagram_range& diagrams,
+                                                             double e = (std::numeric_limits<double>::min)()) {
+  std::vector<Persistence_diagram_points> points;
+  for (auto it = std::begin(diagrams); it != std::end(diagrams); ++it)
+    points.emplace_back(*it, e);
+  const std::size_t n = points.size();
+  std::vector<std::vector<double>> distances(n, std::vector<double>(n, 0.));
+  // Each pair is computed once, the matrix is preallocated so that concurrent writes are in different places
+  auto compute_row = [&](std::size_t i) {
+    for (std::size_t j = i + 1; j < n; ++j) {
+      Persistence_graph g(points[i], points[j]);
+      distances[i][j] = distances[j][i] = bottleneck_distance_of_graph(g, e);
+    }
+  };
+#ifdef GUDHI_USE_TBB
+  // Row i and row n - 1 - i have n - 1 pairs together, tasks are balanced
+  tbb::parallel_for(std::size_t(0), (n + 1) / 2, [&](std::size_t i) {
+    compute_row(i);
+    if (n - 1 - i != i)
+      compute_row(n - 1 - i);
+  });
+#else
+  for (std::size_t i = 0; i < n; ++i)
+    compute_row(i);
+#endif
+  return distances;
 }
 
 }  // namespace persistence_diagram
@@ -15,6 +15,8 @@
 
 #include <vector>
 #include <unordered_set>
+#include <memory>  // for std::shared_ptr
+#include <utility>  // for std::move
 #include <algorithm>
 
 namespace Gudhi {
@@ -22,6 +24,8 @@ namespace Gudhi {
 namespace persistence_diagram {
 
 /** \internal \brief Structure representing a graph matching. The graph is a Persistence_diagrams_graph.
+ *
+ * The kd-tree of the V points is built once and shared by the copies of the matching, as it does not depend on r.
  *
  * \ingroup bottleneck_distance
  */
@@ -39,6 +43,8 @@ class Graph_matching {
  private:
   Persistence_graph* gp;
   double r;
+  /** \internal \brief The V points off the diagonal, all there between two calls to layering. */
+  std::shared_ptr<Internal_point_kd_tree> v_points_off_the_diagonal;
   /** \internal \brief Given a point from V, provides its matched point in U, null_point_index() if there isn't. */
   std::vector<int> v_to_u;
   /** \internal \brief All the unmatched points in U. */
@@ -56,6 +62,11 @@ inline Graph_matching::Graph_matching(Persistence_graph& g)
     : gp(&g), r(0.), v_to_u(g.size(), null_point_index()), unmatched_in_u(g.size()) {
   for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
     unmatched_in_u.insert(u_point_index);
+  std::vector<Internal_point> v_points;
+  for (int v_point_index = 0; v_point_index < g.size(); ++v_point_index)
+    if (!g.on_the_v_diagonal(v_point_index))
+      v_points.push_back(g.get_v_point(v_point_index));
+  v_points_off_the_diagonal = std::make_shared<Internal_point_kd_tree>(std::move(v_points));
 }
 
 inline bool Graph_matching::perfect() const {
@@ -114,9 +125,8 @@ inline bool Graph_matching::augment(Layered_neighbors_finder & layered_nf, int u
 inline Layered_neighbors_finder Graph_matching::layering() const {
   std::vector<int> u_vertices(unmatched_in_u.cbegin(), unmatched_in_u.cend());
   std::vector<int> v_vertices;
-  Neighbors_finder nf(*gp, r);
-  for (int v_point_index = 0; v_point_index < gp->size(); ++v_point_index)
-    nf.add(v_point_index);
+  // The points pulled from the shared tree are put back when nf is destroyed
+  Neighbors_finder nf(*gp, r, *v_points_off_the_diagonal);
   Layered_neighbors_finder layered_nf(*gp, r);
   for (int layer = 0; !u_vertices.empty(); layer++) {
     // one layer is one step in the BFS
@@ -11,65 +11,165 @@
 #ifndef NEIGHBORS_FINDER_H_
 #define NEIGHBORS_FINDER_H_
 
-// Inclusion order is important for CGAL patch
-#include <CGAL/Kd_tree.h>
-#include <CGAL/Search_traits.h>
-
 #include <gudhi/Persistence_graph.h>
 #include <gudhi/Internal_point.h>
 
 #include <unordered_set>
 #include <vector>
-#include <algorithm>  // for std::max
+#include <memory>  // for std::unique_ptr
+#include <utility>  // for std::move
+#include <algorithm>  // for std::max, std::min, std::nth_element
+#include <limits>  // for numeric_limits
 #include <cmath>  // for std::abs
 
 namespace Gudhi {
 
 namespace persistence_diagram {
 
-/** \internal \brief Variant of CGAL::Fuzzy_iso_box to ensure that the box ic closed. It isn't clear how necessary that is.
+/** \internal \brief Static kd-tree of points, from which a point near to a query point can be pulled, i.e. returned
+ * and removed. The pulled points can all be put back at once.
+ *
+ * Each node knows how many of its points are still there, so that the search skips the emptied subtrees. As nothing is
+ * rebuilt when points are pulled or put back, the same tree serves all the searches of a Graph_matching, whatever the
+ * radius.
+ *
+ * \ingroup bottleneck_distance
  */
-struct Square_query {
-  typedef CGAL::Dimension_tag<2> D;
-  typedef Internal_point Point_d;
-  typedef double FT;
-  bool contains(Point_d p) const {
-    return (std::max)(std::abs(p.x()-c.x()), std::abs(p.y()-c.y())) <= size;
+class Internal_point_kd_tree {
+ public:
+  /** \internal \brief Constructor taking the points of the tree. */
+  explicit Internal_point_kd_tree(std::vector<Internal_point> points);
+  /** \internal \brief Returns the point_index of a point at distance at most r from the query point and removes it,
+   * null_point_index() if there isn't such a point. */
+  int pull_near(const Internal_point& query, double r);
+  /** \internal \brief Puts back all the pulled points. */
+  void restore_all();
+
+ private:
+  static const int leaf_size = 8;
+
+  struct Node {
+    double min_x, max_x, min_y, max_y;
+    int count;  // number of points of the subtree which are still there
+    int begin, end;  // range in points
+    int left, right, parent;  // -1 when none
+  };
+
+  int build(int begin, int end, int parent, bool split_on_x);
+  int pull_near(int node, const Internal_point& query, double r);
+  void update_counts(int node, int difference);
+
+  std::vector<Internal_point> points;  // permuted by the kd-tree
+  std::vector<char> present;  // by position in points
+  std::vector<int> leaf_of;  // by position in points
+  std::vector<Node> nodes;
+  std::vector<int> pulled;  // positions in points
+};
+
+inline Internal_point_kd_tree::Internal_point_kd_tree(std::vector<Internal_point> points)
+    : points(std::move(points)), present(this->points.size(), 1), leaf_of(this->points.size()) {
+  if (!this->points.empty())
+    build(0, static_cast<int> (this->points.size()), -1, true);
+}
+
+inline int Internal_point_kd_tree::build(int begin, int end, int parent, bool split_on_x) {
+  int node = static_cast<int> (nodes.size());
+  nodes.push_back(Node());
+  Node n;
+  n.min_x = n.min_y = std::numeric_limits<double>::infinity();
+  n.max_x = n.max_y = -std::numeric_limits<double>::infinity();
+  for (int i = begin; i < end; ++i) {
+    n.min_x = (std::min)(n.min_x, points[i].x());
+    n.max_x = (std::max)(n.max_x, points[i].x());
+    n.min_y = (std::min)(n.min_y, points[i].y());
+    n.max_y = (std::max)(n.max_y, points[i].y());
+  }
+  n.count = end - begin;
+  n.begin = begin;
+  n.end = end;
+  n.left = n.right = -1;
+  n.parent = parent;
+  if (end - begin <= leaf_size) {
+    for (int i = begin; i < end; ++i)
+      leaf_of[i] = node;
+    nodes[node] = n;
+    return node;
   }
-  bool inner_range_intersects(CGAL::Kd_tree_rectangle<FT, D> const&r) const {
-    return
-      r.max_coord(0) >= c.x() - size &&
-      r.min_coord(0) <= c.x() + size &&
-      r.max_coord(1) >= c.y() - size &&
-      r.min_coord(1) <= c.y() + size;
+  int middle = begin + (end - begin) / 2;
+  std::nth_element(points.begin() + begin, points.begin() + middle, points.begin() + end,
+                   [split_on_x](const Internal_point& p1, const Internal_point& p2) {
+                     return split_on_x ? p1.x() < p2.x() : p1.y() < p2.y();
+                   });
+  nodes[node] = n;
+  // nodes may be reallocated by the recursive calls
+  int left = build(begin, middle, node, !split_on_x);
+  int right = build(middle, end, node, !split_on_x);
+  nodes[node].left = left;
+  nodes[node].right = right;
+  return node;
+}
+
+inline int Internal_point_kd_tree::pull_near(const Internal_point& query, double r) {
+  if (nodes.empty())
+    return null_point_index();
+  return pull_near(0, query, r);
+}
+
+inline int Internal_point_kd_tree::pull_near(int node, const Internal_point& query, double r) {
+  const Node& n = nodes[node];
+  // The square query is closed
+  if (n.count == 0 || n.min_x > query.x() + r || n.max_x < query.x() - r ||
+      n.min_y > query.y() + r || n.max_y < query.y() - r)
+    return null_point_index();
+  if (n.left == -1) {
+    for (int i = n.begin; i < n.end; ++i) {
+      if (present[i] && (std::max)(std::abs(points[i].x() - query.x()), std::abs(points[i].y() - query.y())) <= r) {
+        present[i] = 0;
+        pulled.push_back(i);
+        update_counts(node, -1);
+        return points[i].point_index;
+      }
+    }
+    return null_point_index();
   }
-  bool outer_range_contains(CGAL::Kd_tree_rectangle<FT, D> const&r) const {
-    return
-      r.min_coord(0) >= c.x() - size &&
-      r.max_coord(0) <= c.x() + size &&
-      r.min_coord(1) >= c.y() - size &&
-      r.max_coord(1) <= c.y() + size;
+  int result = pull_near(n.left, query, r);
+  if (result == null_point_index())
+    result = pull_near(nodes[node].right, query, r);
+  return result;
+}
+
+inline void Internal_point_kd_tree::restore_all() {
+  for (int i : pulled) {
+    present[i] = 1;
+    update_counts(leaf_of[i], 1);
   }
-  Point_d c;
-  FT size;
-};
+  pulled.clear();
+}
+
+inline void Internal_point_kd_tree::update_counts(int node, int difference) {
+  for (; node != -1; node = nodes[node].parent)
+    nodes[node].count += difference;
+}
 
 /** \internal \brief data structure used to find any point (including projections) in V near to a query point from U
  * (which can be a projection).
  *
  * V points have to be added manually using their index and before the first pull. A neighbor pulled is automatically
- * removed.
+ * removed. Alternatively, all the V points can be borrowed from an Internal_point_kd_tree of the V points off the
+ * diagonal, which is restored when the Neighbors_finder is destroyed.
  *
  * \ingroup bottleneck_distance
  */
 class Neighbors_finder {
-  typedef CGAL::Dimension_tag<2> D;
-  typedef CGAL::Search_traits<double, Internal_point, const double*, Construct_coord_iterator, D> Traits;
-  typedef CGAL::Kd_tree<Traits> Kd_tree;
-
  public:
   /** \internal \brief Constructor taking the near distance definition as parameter. */
   Neighbors_finder(const Persistence_graph& g, double r);
+  /** \internal \brief Constructor taking the near distance definition and the tree of the V points off the diagonal
+   * as parameters. All the V points are added. */
+  Neighbors_finder(const Persistence_graph& g, double r, Internal_point_kd_tree& v_points_off_the_diagonal);
+  Neighbors_finder(const Neighbors_finder&) = delete;
+  Neighbors_finder& operator=(const Neighbors_finder&) = delete;
+  ~Neighbors_finder();
   /** \internal \brief A point added will be possibly pulled. */
   void add(int v_point_index);
   /** \internal \brief Returns and remove a V point near to the U point given as parameter, null_point_index() if
@@ -81,7 +181,9 @@ class Neighbors_finder {
  private:
   const Persistence_graph& g;
   const double r;
-  Kd_tree kd_t;
+  std::vector<Internal_point> added_points;  // until the first pull
+  std::unique_ptr<Internal_point_kd_tree> own_kd_t;
+  Internal_point_kd_tree* kd_t;  // own_kd_t, or the borrowed tree
   std::unordered_set<int> projections_f;
 };
 
@@ -112,13 +214,26 @@ class Layered_neighbors_finder {
 };
 
 inline Neighbors_finder::Neighbors_finder(const Persistence_graph& g, double r) :
-    g(g), r(r), kd_t(), projections_f() { }
+    g(g), r(r), added_points(), own_kd_t(), kd_t(nullptr), projections_f() { }
+
+inline Neighbors_finder::Neighbors_finder(const Persistence_graph& g, double r,
+                                          Internal_point_kd_tree& v_points_off_the_diagonal) :
+    g(g), r(r), added_points(), own_kd_t(), kd_t(&v_points_off_the_diagonal), projections_f() {
+  for (int v_point_index = 0; v_point_index < g.size(); ++v_point_index)
+    if (g.on_the_v_diagonal(v_point_index))
+      projections_f.emplace(v_point_index);
+}
+
+inline Neighbors_finder::~Neighbors_finder() {
+  if (kd_t != nullptr && !own_kd_t)
+    kd_t->restore_all();
+}
 
 inline void Neighbors_finder::add(int v_point_index) {
   if (g.on_the_v_diagonal(v_point_index))
     projections_f.emplace(v_point_index);
   else
-    kd_t.insert(g.get_v_point(v_point_index));
+    added_points.push_back(g.get_v_point(v_point_index));
 }
 
 inline int Neighbors_finder::pull_near(int u_point_index) {
@@ -134,14 +249,11 @@ inline int Neighbors_finder::pull_near(int u_point_index) {
     projections_f.erase(tmp);
   } else {
     // Is the query point near to a V point in the plane ?
-    Internal_point u_point = g.get_u_point(u_point_index);
-    auto neighbor = kd_t.search_any_point(Square_query{u_point, r});
-    if (!neighbor)
-      return null_point_index();
-    tmp = neighbor->point_index;
-    auto point = g.get_v_point(tmp);
-    int idx = point.point_index;
-    kd_t.remove(point, [idx](Internal_point const&p){return p.point_index == idx;});
+    if (kd_t == nullptr) {
+      own_kd_t.reset(new Internal_point_kd_tree(std::move(added_points)));
+      kd_t = own_kd_t.get();
+    }
+    tmp = kd_t->pull_near(g.get_u_point(u_point_index), r);
   }
   return tmp;
 }
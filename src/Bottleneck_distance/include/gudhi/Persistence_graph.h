@@ -20,11 +20,38 @@
 #include <vector>
 #include <algorithm>
 #include <limits>  // for numeric_limits
+#include <cmath>  // for std::fabs
 
 namespace Gudhi {
 
 namespace persistence_diagram {
 
+/** \internal \brief Points of a persistence diagram as needed by a Persistence_graph: the finite points further than
+ * e from the diagonal, and the sorted births of the infinite points. When many distances are computed, this is done
+ * once per diagram.
+ *
+ * \ingroup bottleneck_distance
+ */
+struct Persistence_diagram_points {
+  /** \internal \brief Constructor taking a PersistenceDiagram (concept) as parameter. */
+  template<typename Persistence_diagram>
+  Persistence_diagram_points(const Persistence_diagram& diag, double e);
+
+  std::vector<Internal_point> finite;
+  std::vector<double> alive;
+};
+
+template<typename Persistence_diagram>
+Persistence_diagram_points::Persistence_diagram_points(const Persistence_diagram& diag, double e) {
+  for (auto it = std::begin(diag); it != std::end(diag); ++it) {
+    if (std::get<1>(*it) == std::numeric_limits<double>::infinity())
+      alive.push_back(std::get<0>(*it));
+    else if (std::get<1>(*it) - std::get<0>(*it) > e)
+      finite.push_back(Internal_point(std::get<0>(*it), std::get<1>(*it), finite.size()));
+  }
+  std::sort(alive.begin(), alive.end());
+}
+
 /** \internal \brief Structure representing an euclidean bipartite graph containing
  *  the points from the two persistence diagrams (including the projections).
  *
@@ -35,6 +62,8 @@ class Persistence_graph {
   /** \internal \brief Constructor taking 2 PersistenceDiagrams (concept) as parameters. */
   template<typename Persistence_diagram1, typename Persistence_diagram2>
   Persistence_graph(const Persistence_diagram1& diag1, const Persistence_diagram2& diag2, double e);
+  /** \internal \brief Constructor taking the points of 2 persistence diagrams, filtered with the same e. */
+  Persistence_graph(const Persistence_diagram_points& diag1, const Persistence_diagram_points& diag2);
   /** \internal \brief Is the given point from U the projection of a point in V ? */
   bool on_the_u_diagonal(int u_point_index) const;
   /** \internal \brief Is the given point from V the projection of a point in U ? */
@@ -49,6 +78,10 @@ class Persistence_graph {
   int size() const;
   /** \internal \brief Is there as many infinite points (alive components) in both diagrams ? */
   double bottleneck_alive() const;
+  /** \internal \brief Calls f(d) for each of the O(n^2) distances d between the points, duplicates included, without
+   * storing them. */
+  template<typename Function>
+  void for_each_distance(Function f) const;
   /** \internal \brief Returns the O(n^2) sorted distances between the points. */
   std::vector<double> sorted_distances() const;
   /** \internal \brief Returns an upper bound for the diameter of the convex hull of all non infinite points */
@@ -67,29 +100,17 @@ class Persistence_graph {
 template<typename Persistence_diagram1, typename Persistence_diagram2>
 Persistence_graph::Persistence_graph(const Persistence_diagram1 &diag1,
                                      const Persistence_diagram2 &diag2, double e)
-    : u(), v(), b_alive(0.) {
-  std::vector<double> u_alive;
-  std::vector<double> v_alive;
-  for (auto it = std::begin(diag1); it != std::end(diag1); ++it) {
-    if (std::get<1>(*it) == std::numeric_limits<double>::infinity())
-      u_alive.push_back(std::get<0>(*it));
-    else if (std::get<1>(*it) - std::get<0>(*it) > e)
-      u.push_back(Internal_point(std::get<0>(*it), std::get<1>(*it), u.size()));
-  }
-  for (auto it = std::begin(diag2); it != std::end(diag2); ++it) {
-    if (std::get<1>(*it) == std::numeric_limits<double>::infinity())
-      v_alive.push_back(std::get<0>(*it));
-    else if (std::get<1>(*it) - std::get<0>(*it) > e)
-      v.push_back(Internal_point(std::get<0>(*it), std::get<1>(*it), v.size()));
-  }
+    : Persistence_graph(Persistence_diagram_points(diag1, e), Persistence_diagram_points(diag2, e)) { }
+
+inline Persistence_graph::Persistence_graph(const Persistence_diagram_points& diag1,
+                                            const Persistence_diagram_points& diag2)
+    : u(diag1.finite), v(diag2.finite), b_alive(0.) {
   if (u.size() < v.size())
     swap(u, v);
-  std::sort(u_alive.begin(), u_alive.end());
-  std::sort(v_alive.begin(), v_alive.end());
-  if (u_alive.size() != v_alive.size()) {
+  if (diag1.alive.size() != diag2.alive.size()) {
     b_alive = std::numeric_limits<double>::infinity();
   } else {
-    for (auto it_u = u_alive.cbegin(), it_v = v_alive.cbegin(); it_u != u_alive.cend(); ++it_u, ++it_v)
+    for (auto it_u = diag1.alive.cbegin(), it_v = diag2.alive.cbegin(); it_u != diag1.alive.cend(); ++it_u, ++it_v)
       b_alive = (std::max)(b_alive, std::fabs(*it_u - *it_v));
   }
 }
@@ -128,14 +149,19 @@ inline double Persistence_graph::bottleneck_alive() const {
   return b_alive;
 }
 
-inline std::vector<double> Persistence_graph::sorted_distances() const {
-  std::vector<double> distances;
-  distances.push_back(0.);  // for empty diagrams
+template<typename Function>
+void Persistence_graph::for_each_distance(Function f) const {
+  f(0.);  // for empty diagrams
   for (int u_point_index = 0; u_point_index < size(); ++u_point_index) {
-    distances.push_back(distance(u_point_index, corresponding_point_in_v(u_point_index)));
+    f(distance(u_point_index, corresponding_point_in_v(u_point_index)));
     for (int v_point_index = 0; v_point_index < size(); ++v_point_index)
-      distances.push_back(distance(u_point_index, v_point_index));
+      f(distance(u_point_index, v_point_index));
   }
+}
+
+inline std::vector<double> Persistence_graph::sorted_distances() const {
+  std::vector<double> distances;
+  for_each_distance([&distances](double d) { distances.push_back(d); });
 #ifdef GUDHI_USE_TBB
   tbb::parallel_sort(distances.begin(), distances.end());
 #else
@@ -0,0 +1,233 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef WASSERSTEIN_H_
+#define WASSERSTEIN_H_
+
+#include <gudhi/Persistence_graph.h>
+#include <gudhi/Auction_neighbors_finder.h>
+#include <gudhi/Debug_utils.h>
+
+#include <vector>
+#include <set>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::max
+#include <limits>  // for numeric_limits
+#include <cmath>  // for std::pow, std::fabs, std::nextafter
+#include <stdexcept>  // for std::invalid_argument
+
+namespace Gudhi {
+
+namespace persistence_diagram {
+
+/** \internal \brief Auction algorithm computing a matching of minimal cost between the points of U and V of a
+ * Persistence_graph, where the cost of an edge is a power of its length.
+ *
+ * Points of U are the bidders and points of V are the items. A point off the diagonal may be matched to any point of V
+ * off the diagonal, or to its own projection. A point on the diagonal may be matched to any point of V on the
+ * diagonal, at no cost, or to the point it is the projection of.
+ *
+ * \ingroup bottleneck_distance
+ */
+class Wasserstein_auction {
+ public:
+  /** \internal \brief Constructor taking the graph and the order of the Wasserstein distance. */
+  Wasserstein_auction(const Persistence_graph& g, double order);
+  /** \internal \brief Returns a matching cost at most 1 + delta times the optimal one. */
+  double cost(double delta);
+
+ private:
+  double edge_cost(int u_point_index, int v_point_index) const;
+  double price(int v_point_index) const;
+  void set_price(int v_point_index, double price);
+  void bid(int u_point_index, double epsilon, std::vector<int>& unassigned);
+  double run(double epsilon);
+
+  const Persistence_graph& g;
+  double order;
+  int u_finite;  // points of U with an index lower than u_finite are off the diagonal
+  int v_finite;  // same for V
+  Auction_neighbors_finder finite_items;
+  std::vector<double> diagonal_prices;  // prices of the points of V on the diagonal, from index v_finite
+  std::set<std::pair<double, int>> diagonal_items;  // sorted by price
+  std::vector<int> item_of;  // by point of U, null_point_index() when unassigned
+  std::vector<int> bidder_of;  // by point of V, null_point_index() when unassigned
+};
+
+inline std::vector<Internal_point> finite_v_points(const Persistence_graph& g) {
+  std::vector<Internal_point> points;
+  for (int v_point_index = 0; v_point_index < g.size() && !g.on_the_v_diagonal(v_point_index); ++v_point_index)
+    points.push_back(g.get_v_point(v_point_index));
+  return points;
+}
+
+inline Wasserstein_auction::Wasserstein_auction(const Persistence_graph& g, double order)
+    : g(g),
+      order(order),
+      finite_items(finite_v_points(g), order),
+      item_of(g.size(), null_point_index()),
+      bidder_of(g.size(), null_point_index()) {
+  for (u_finite = 0; u_finite < g.size() && !g.on_the_u_diagonal(u_finite); ++u_finite) {}
+  v_finite = g.size() - u_finite;
+  diagonal_prices.assign(g.size() - v_finite, 0.);
+  for (int v_point_index = v_finite; v_point_index < g.size(); ++v_point_index)
+    diagonal_items.emplace(0., v_point_index);
+}
+
+inline double Wasserstein_auction::edge_cost(int u_point_index, int v_point_index) const {
+  return wasserstein_cost(g.distance(u_point_index, v_point_index), order);
+}
+
+inline double Wasserstein_auction::price(int v_point_index) const {
+  if (g.on_the_v_diagonal(v_point_index))
+    return diagonal_prices[v_point_index - v_finite];
+  return finite_items.price(v_point_index);
+}
+
+inline void Wasserstein_auction::set_price(int v_point_index, double price) {
+  if (g.on_the_v_diagonal(v_point_index)) {
+    double& diagonal_price = diagonal_prices[v_point_index - v_finite];
+    diagonal_items.erase(std::make_pair(diagonal_price, v_point_index));
+    diagonal_price = price;
+    diagonal_items.emplace(diagonal_price, v_point_index);
+  } else {
+    finite_items.set_price(v_point_index, price);
+  }
+}
+
+inline void Wasserstein_auction::bid(int u_point_index, double epsilon, std::vector<int>& unassigned) {
+  int best = null_point_index();
+  double best_cost = std::numeric_limits<double>::infinity();
+  double second_cost = std::numeric_limits<double>::infinity();
+  auto consider = [&](int v_point_index, double cost) {
+    if (cost < best_cost) {
+      second_cost = best_cost;
+      best_cost = cost;
+      best = v_point_index;
+    } else if (cost < second_cost) {
+      second_cost = cost;
+    }
+  };
+  // Its projection, or the point it is the projection of
+  int corresponding = g.corresponding_point_in_v(u_point_index);
+  consider(corresponding, edge_cost(u_point_index, corresponding) + price(corresponding));
+  if (g.on_the_u_diagonal(u_point_index)) {
+    int considered = 0;
+    for (auto it = diagonal_items.cbegin(); it != diagonal_items.cend() && considered < 2; ++it, ++considered)
+      consider(it->second, it->first);
+  } else {
+    int finite_best;
+    double finite_best_cost, finite_second_cost;
+    finite_items.best_two(g.get_u_point(u_point_index), finite_best, finite_best_cost, finite_second_cost);
+    if (finite_best != null_point_index()) {
+      consider(finite_best, finite_best_cost);
+      if (second_cost > finite_second_cost)
+        second_cost = finite_second_cost;
+    }
+  }
+  // The price is raised so that the item is still the best one for the bidder, up to epsilon
+  double increment = epsilon;
+  if (second_cost != std::numeric_limits<double>::infinity())
+    increment += second_cost - best_cost;
+  double old_price = price(best);
+  double new_price = old_price + increment;
+  // When the increment is lost in the rounding of a large price, the price must still strictly increase, otherwise
+  // two bidders could outbid each other forever
+  if (!(new_price > old_price))
+    new_price = std::nextafter(old_price, std::numeric_limits<double>::infinity());
+  set_price(best, new_price);
+  int previous_bidder = bidder_of[best];
+  if (previous_bidder != null_point_index()) {
+    item_of[previous_bidder] = null_point_index();
+    unassigned.push_back(previous_bidder);
+  }
+  bidder_of[best] = u_point_index;
+  item_of[u_point_index] = best;
+}
+
+inline double Wasserstein_auction::run(double epsilon) {
+  // Prices are kept from the previous run, which is what makes epsilon-scaling efficient
+  std::fill(item_of.begin(), item_of.end(), null_point_index());
+  std::fill(bidder_of.begin(), bidder_of.end(), null_point_index());
+  std::vector<int> unassigned;
+  for (int u_point_index = g.size() - 1; u_point_index >= 0; --u_point_index)
+    unassigned.push_back(u_point_index);
+  while (!unassigned.empty()) {
+    int u_point_index = unassigned.back();
+    unassigned.pop_back();
+    bid(u_point_index, epsilon, unassigned);
+  }
+  double cost = 0.;
+  for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
+    cost += edge_cost(u_point_index, item_of[u_point_index]);
+  return cost;
+}
+
+inline double Wasserstein_auction::cost(double delta) {
+  // The scale of the costs, from the matching of every point to its projection
+  double max_cost = 0.;
+  for (int u_point_index = 0; u_point_index < g.size(); ++u_point_index)
+    max_cost = (std::max)(max_cost, edge_cost(u_point_index, g.corresponding_point_in_v(u_point_index)));
+  if (max_cost == 0.)
+    return 0.;
+  // The matching of a run is at most n * epsilon more expensive than the optimal one
+  double epsilon = max_cost / 4.;
+  while (true) {
+    double cost = run(epsilon);
+    if (g.size() * epsilon * (1. + delta) <= delta * cost || cost == 0.)
+      return cost;
+    epsilon /= 5.;
+    // Prices would not increase anymore, the matching is exact up to rounding errors
+    if (epsilon < max_cost * std::numeric_limits<double>::epsilon())
+      return cost;
+  }
+}
+
+/** \brief Function to compute the Wasserstein distance between two persistence diagrams.
+ *
+ * The Wasserstein distance of order `order` is the `order`-th root of the minimum, over all the matchings between the
+ * points of the diagrams and their projections on the diagonal, of the sum of the `order`-th powers of the lengths of
+ * the edges, these lengths being measured with the \f$L^\infty\f$ norm as for the Bottleneck distance. It is computed
+ * by an auction algorithm with epsilon-scaling, where the best items of a bidder are found with a kd-tree aware of the
+ * prices.
+ *
+ * \tparam Persistence_diagram1,Persistence_diagram2
+ * models of the concept `PersistenceDiagram`.
+ *
+ * \param[in] diag1 The first persistence diagram.
+ * \param[in] diag2 The second persistence diagram.
+ * \param[in] order The order of the Wasserstein distance, at least 1.
+ * \param[in] delta The relative error allowed on the distance, greater than 0.
+ *
+ * \return The Wasserstein distance, infinite if the diagrams do not have the same number of infinite points.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+double wasserstein_distance(const Persistence_diagram1 &diag1, const Persistence_diagram2 &diag2,
+                            double order = 1., double delta = 0.01) {
+  GUDHI_CHECK(order >= 1., std::invalid_argument("wasserstein_distance - order must be at least 1"));
+  GUDHI_CHECK(delta > 0., std::invalid_argument("wasserstein_distance - delta must be positive"));
+  Persistence_diagram_points points1(diag1, 0.);
+  Persistence_diagram_points points2(diag2, 0.);
+  if (points1.alive.size() != points2.alive.size())
+    return std::numeric_limits<double>::infinity();
+  // The infinite points are matched in the order of their births
+  double cost = 0.;
+  for (std::size_t i = 0; i < points1.alive.size(); ++i)
+    cost += wasserstein_cost(std::fabs(points1.alive[i] - points2.alive[i]), order);
+  Persistence_graph g(points1, points2);
+  Wasserstein_auction auction(g, order);
+  cost += auction.cost(delta);
+  return std::pow(cost, 1. / order);
+}
+
+}  // namespace persistence_diagram
+
+}  // namespace Gudhi
+
+#endif  // WASSERSTEIN_H_
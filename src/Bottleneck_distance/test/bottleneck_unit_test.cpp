@@ -14,6 +14,10 @@
 #include <boost/test/unit_test.hpp>
 
 #include <random>
+#include <vector>
+#include <algorithm>  // for std::sort, std::max
+#include <cmath>  // for std::abs
+#include <limits>  // for std::numeric_limits
 #include <gudhi/Bottleneck.h>
 
 using namespace Gudhi::persistence_diagram;
@@ -96,6 +100,72 @@ BOOST_AUTO_TEST_CASE(neighbors_finder) {
   BOOST_CHECK(v_point_index_2 == -1);
 }
 
+// Pulls all the points of the tree at distance at most r from the query point, sorted by point_index
+std::vector<int> pull_all_near(Internal_point_kd_tree& kd_tree, const Internal_point& query, double r) {
+  std::vector<int> pulled;
+  for (int point_index = kd_tree.pull_near(query, r); point_index != null_point_index();
+       point_index = kd_tree.pull_near(query, r))
+    pulled.push_back(point_index);
+  std::sort(pulled.begin(), pulled.end());
+  return pulled;
+}
+
+BOOST_AUTO_TEST_CASE(internal_point_kd_tree) {
+  // Points on a coarse grid, so that some of them are equal or on the boundary of the query squares
+  std::default_random_engine kd_tree_re(3);
+  std::uniform_int_distribution<int> coordinate(0, 40);
+  std::vector<Internal_point> points;
+  for (int point_index = 0; point_index < 500; ++point_index)
+    points.emplace_back(coordinate(kd_tree_re) / 4., coordinate(kd_tree_re) / 4., point_index);
+  Internal_point_kd_tree kd_tree(points);
+  std::vector<int> all_points(points.size());
+  for (int point_index = 0; point_index < static_cast<int> (points.size()); ++point_index)
+    all_points[point_index] = point_index;
+
+  for (double r : {0., 0.25, 1., 3.}) {
+    for (int i = 0; i < 50; ++i) {
+      Internal_point query(coordinate(kd_tree_re) / 4., coordinate(kd_tree_re) / 4., null_point_index());
+      std::vector<int> expected;
+      for (auto& point : points)
+        if ((std::max)(std::abs(point.x() - query.x()), std::abs(point.y() - query.y())) <= r)
+          expected.push_back(point.point_index);
+      BOOST_CHECK(pull_all_near(kd_tree, query, r) == expected);
+      // Pulled points are not found again until they are put back
+      BOOST_CHECK(kd_tree.pull_near(query, r) == null_point_index());
+      BOOST_CHECK(pull_all_near(kd_tree, query, std::numeric_limits<double>::infinity()).size() ==
+                  points.size() - expected.size());
+      kd_tree.restore_all();
+    }
+  }
+  BOOST_CHECK(pull_all_near(kd_tree, points[0], std::numeric_limits<double>::infinity()) == all_points);
+  kd_tree.restore_all();
+
+  // Tree borrowed by a Neighbors_finder for each layering of a Graph_matching: it must be complete again after each
+  // Neighbors_finder is destroyed
+  Persistence_graph g(v1, v2, 0.);
+  std::vector<Internal_point> v_points;
+  std::vector<int> v_points_off_the_diagonal;
+  for (int v_point_index = 0; v_point_index < g.size(); ++v_point_index) {
+    if (!g.on_the_v_diagonal(v_point_index)) {
+      v_points.push_back(g.get_v_point(v_point_index));
+      v_points_off_the_diagonal.push_back(v_point_index);
+    }
+  }
+  Internal_point_kd_tree borrowed_kd_tree(v_points);
+  for (double r : {1., 10., 50., upper_bound}) {
+    {
+      Neighbors_finder nf(g, r, borrowed_kd_tree);
+      for (int u_point_index = 0; u_point_index < g.size(); u_point_index += 3) {
+        for (int v_point_index : nf.pull_all_near(u_point_index))
+          BOOST_CHECK(g.distance(u_point_index, v_point_index) <= r);
+      }
+    }
+    BOOST_CHECK(pull_all_near(borrowed_kd_tree, v_points[0], std::numeric_limits<double>::infinity()) ==
+                v_points_off_the_diagonal);
+    borrowed_kd_tree.restore_all();
+  }
+}
+
 BOOST_AUTO_TEST_CASE(layered_neighbors_finder) {
   Persistence_graph g(v1, v2, 0.);
   Layered_neighbors_finder lnf(g, 1.);
@@ -153,3 +223,51 @@ BOOST_AUTO_TEST_CASE(global) {
   BOOST_CHECK(bottleneck_distance(v1, v2, upper_bound / 10000.) <= upper_bound / 100. + upper_bound / 10000.);
   BOOST_CHECK(std::abs(bottleneck_distance(v1, v2, 0.) - bottleneck_distance(v1, v2, upper_bound / 10000.)) <= upper_bound / 10000.);
 }
+
+BOOST_AUTO_TEST_CASE(distance_matrix) {
+  std::uniform_real_distribution<double> unif1(0., upper_bound);
+  std::default_random_engine re;
+  std::vector< std::vector< std::pair<double, double> > > diagrams(6);
+  for (auto& diagram : diagrams) {
+    for (int i = 0; i < n1; i++) {
+      double a = unif1(re);
+      double b = unif1(re);
+      diagram.emplace_back(std::min(a, b), std::max(a, b));
+    }
+    diagram.emplace_back(unif1(re), std::numeric_limits<double>::infinity());
+  }
+  // Not the same number of infinite points
+  diagrams[4].emplace_back(unif1(re), std::numeric_limits<double>::infinity());
+
+  for (double e : {0., upper_bound / 10000.}) {
+    std::vector< std::vector<double> > distances = bottleneck_distance_matrix(diagrams, e);
+    BOOST_CHECK(distances.size() == diagrams.size());
+    for (std::size_t i = 0; i < diagrams.size(); i++) {
+      BOOST_CHECK(distances[i].size() == diagrams.size());
+      BOOST_CHECK(distances[i][i] == 0.);
+      for (std::size_t j = i + 1; j < diagrams.size(); j++) {
+        BOOST_CHECK(distances[i][j] == distances[j][i]);
+        BOOST_CHECK(distances[i][j] == bottleneck_distance(diagrams[i], diagrams[j], e));
+      }
+    }
+    BOOST_CHECK(distances[0][4] == std::numeric_limits<double>::infinity());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(exact_distance) {
+  // The exact distance is the smallest of the sorted distances for which there is a perfect matching
+  Persistence_graph g(v1, v2, 0.);
+  double b = bottleneck_distance_exact(g);
+  std::vector<double> d(g.sorted_distances());
+  auto it = std::lower_bound(d.cbegin(), d.cend(), b);
+  BOOST_CHECK(it != d.cend() && *it == b);
+  Graph_matching m(g);
+  if (it != d.cbegin()) {
+    m.set_r(*(it - 1));
+    while (m.multi_augment()) {}
+    BOOST_CHECK(!m.perfect());
+  }
+  m.set_r(b);
+  while (m.multi_augment()) {}
+  BOOST_CHECK(m.perfect());
+}
@@ -0,0 +1,174 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "wasserstein distance"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Wasserstein.h>
+
+#include <random>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::next_permutation, std::min, std::max
+#include <limits>  // for numeric_limits
+#include <cmath>  // for std::pow, std::fabs
+
+using namespace Gudhi::persistence_diagram;
+
+typedef std::vector<std::pair<double, double>> Diagram;
+
+// Costs of the matchings, where each point can also go to the diagonal: points of diag1, then the diagonal slots of
+// diag2, against points of diag2 then the diagonal slots of diag1
+std::vector<std::vector<double>> matching_costs(const Diagram& diag1, const Diagram& diag2, double order) {
+  const std::size_t n = diag1.size() + diag2.size();
+  std::vector<std::vector<double>> costs(n, std::vector<double>(n, 0.));
+  for (std::size_t i = 0; i < diag1.size(); ++i) {
+    for (std::size_t j = 0; j < diag2.size(); ++j)
+      costs[i][j] = std::pow((std::max)(std::fabs(diag1[i].first - diag2[j].first),
+                                        std::fabs(diag1[i].second - diag2[j].second)), order);
+    for (std::size_t j = diag2.size(); j < n; ++j)
+      costs[i][j] = std::pow((diag1[i].second - diag1[i].first) / 2., order);
+  }
+  for (std::size_t i = diag1.size(); i < n; ++i)
+    for (std::size_t j = 0; j < diag2.size(); ++j)
+      costs[i][j] = std::pow((diag2[j].second - diag2[j].first) / 2., order);
+  return costs;
+}
+
+// Minimum over all the permutations of the cost of the matchings
+double brute_force_wasserstein(const Diagram& diag1, const Diagram& diag2, double order) {
+  std::vector<std::vector<double>> costs = matching_costs(diag1, diag2, order);
+  const std::size_t n = costs.size();
+  std::vector<std::size_t> permutation(n);
+  for (std::size_t i = 0; i < n; ++i)
+    permutation[i] = i;
+  double best = std::numeric_limits<double>::infinity();
+  do {
+    double cost = 0.;
+    for (std::size_t i = 0; i < n; ++i)
+      cost += costs[i][permutation[i]];
+    best = (std::min)(best, cost);
+  } while (std::next_permutation(permutation.begin(), permutation.end()));
+  return std::pow(best, 1. / order);
+}
+
+// Exact minimum with the Hungarian algorithm, in O(n^3), for diagrams too large for the brute force
+double hungarian_wasserstein(const Diagram& diag1, const Diagram& diag2, double order) {
+  std::vector<std::vector<double>> costs = matching_costs(diag1, diag2, order);
+  const std::size_t n = costs.size();
+  const double inf = std::numeric_limits<double>::infinity();
+  // Potentials of the rows and the columns, and the row matched to each column, all shifted by one
+  std::vector<double> row_potential(n + 1, 0.), column_potential(n + 1, 0.);
+  std::vector<std::size_t> row_of(n + 1, 0), way(n + 1, 0);
+  for (std::size_t i = 1; i <= n; ++i) {
+    row_of[0] = i;
+    std::size_t column = 0;
+    std::vector<double> min_slack(n + 1, inf);
+    std::vector<bool> used(n + 1, false);
+    do {
+      used[column] = true;
+      std::size_t row = row_of[column], next_column = 0;
+      double delta = inf;
+      for (std::size_t j = 1; j <= n; ++j) {
+        if (used[j]) continue;
+        double slack = costs[row - 1][j - 1] - row_potential[row] - column_potential[j];
+        if (slack < min_slack[j]) {
+          min_slack[j] = slack;
+          way[j] = column;
+        }
+        if (min_slack[j] < delta) {
+          delta = min_slack[j];
+          next_column = j;
+        }
+      }
+      for (std::size_t j = 0; j <= n; ++j) {
+        if (used[j]) {
+          row_potential[row_of[j]] += delta;
+          column_potential[j] -= delta;
+        } else {
+          min_slack[j] -= delta;
+        }
+      }
+      column = next_column;
+    } while (row_of[column] != 0);
+    do {
+      std::size_t previous_column = way[column];
+      row_of[column] = row_of[previous_column];
+      column = previous_column;
+    } while (column != 0);
+  }
+  double cost = 0.;
+  for (std::size_t j = 1; j <= n; ++j)
+    cost += costs[row_of[j] - 1][j - 1];
+  return std::pow(cost, 1. / order);
+}
+
+Diagram random_diagram(std::size_t size, std::default_random_engine& re) {
+  std::uniform_real_distribution<double> unif(0., 10.);
+  Diagram diagram;
+  for (std::size_t i = 0; i < size; ++i) {
+    double a = unif(re);
+    double b = unif(re);
+    diagram.emplace_back((std::min)(a, b), (std::max)(a, b));
+  }
+  return diagram;
+}
+
+BOOST_AUTO_TEST_CASE(wasserstein_small_diagrams) {
+  Diagram diag1 = {{0., 2.}, {1., 5.}};
+  Diagram diag2 = {{0., 2.2}, {1.5, 4.}};
+  Diagram empty;
+  // Both points go to the diagonal
+  BOOST_CHECK_CLOSE(wasserstein_distance(diag1, empty), 1. + 2., 1e-8);
+  BOOST_CHECK_CLOSE(wasserstein_distance(empty, diag1, 2.), std::sqrt(1. + 4.), 1e-8);
+  BOOST_CHECK(wasserstein_distance(empty, empty) == 0.);
+  BOOST_CHECK(wasserstein_distance(diag1, diag1) == 0.);
+  // 0.2 + 1. with a delta of 1%
+  BOOST_CHECK_CLOSE(wasserstein_distance(diag1, diag2), 1.2, 1.);
+  BOOST_CHECK_CLOSE(wasserstein_distance(diag2, diag1), 1.2, 1.);
+  // Infinite points are matched together
+  Diagram diag3 = {{0., 2.}, {1., std::numeric_limits<double>::infinity()}};
+  Diagram diag4 = {{0., 2.}, {3., std::numeric_limits<double>::infinity()}};
+  BOOST_CHECK_CLOSE(wasserstein_distance(diag3, diag4), 2., 1e-8);
+  BOOST_CHECK(wasserstein_distance(diag1, diag4) == std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE(wasserstein_against_brute_force) {
+  std::default_random_engine re;
+  for (double order : {1., 2., 3.5}) {
+    for (std::size_t size1 = 0; size1 <= 4; ++size1) {
+      for (std::size_t size2 = 0; size1 + size2 <= 7; ++size2) {
+        Diagram diag1 = random_diagram(size1, re);
+        Diagram diag2 = random_diagram(size2, re);
+        double expected = brute_force_wasserstein(diag1, diag2, order);
+        double delta = 0.001;
+        double distance = wasserstein_distance(diag1, diag2, order, delta);
+        BOOST_CHECK(distance >= expected * (1. - 1e-12));
+        BOOST_CHECK(distance <= expected * (1. + delta) + 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(wasserstein_large_diagrams) {
+  std::default_random_engine re;
+  Diagram diag1 = random_diagram(150, re);
+  Diagram diag2 = random_diagram(120, re);
+  for (double order : {1., 2.}) {
+    double expected = hungarian_wasserstein(diag1, diag2, order);
+    // Each approximation is only guaranteed to be within its own bound of the exact distance
+    for (double delta : {0.01, 0.0001}) {
+      double distance = wasserstein_distance(diag1, diag2, order, delta);
+      BOOST_CHECK(distance >= expected * (1. - 1e-12));
+      BOOST_CHECK(distance <= expected * (1. + delta) + 1e-12);
+      double reverse = wasserstein_distance(diag2, diag1, order, delta);
+      BOOST_CHECK(reverse >= expected * (1. - 1e-12));
+      BOOST_CHECK(reverse <= expected * (1. + delta) + 1e-12);
+    }
+  }
+}
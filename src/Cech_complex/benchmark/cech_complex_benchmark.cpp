@@ -85,8 +85,8 @@ int main(int argc, char* argv[]) {
   boost::filesystem::path full_path(boost::filesystem::current_path());
   std::cout << "Current path is : " << full_path << std::endl;
 
-  std::cout << "File name;Radius;Rips time;Cech time; Ratio Rips/Cech time;Rips nb simplices;Cech nb simplices;"
-            << std::endl;
+  std::cout << "File name;Radius;Rips time;Cech time; Ratio Rips/Cech time;Parallel Cech time;Rips nb simplices;"
+            << "Cech nb simplices;Same parallel Cech complex;" << std::endl;
   boost::filesystem::directory_iterator end_itr;  // default construction yields past-the-end
   for (boost::filesystem::directory_iterator itr(boost::filesystem::current_path()); itr != end_itr; ++itr) {
     if (!boost::filesystem::is_directory(itr->status())) {
@@ -120,9 +120,16 @@ int main(int argc, char* argv[]) {
           std::cout << cech_sec << ";";
           std::cout << cech_sec / rips_sec << ";";
 
+          Gudhi::Clock parallel_cech_clock("Parallel Cech computation");
+          Cech_complex parallel_cech_complex_from_points(off_reader.get_point_cloud(), radius);
+          Simplex_tree parallel_cech_stree;
+          parallel_cech_complex_from_points.create_complex_parallel(parallel_cech_stree, p0.size() - 1);
+          std::cout << parallel_cech_clock.num_seconds() << ";";
+
           assert(rips_stree.num_simplices() >= cech_stree.num_simplices());
           std::cout << rips_stree.num_simplices() << ";";
-          std::cout << cech_stree.num_simplices() << ";" << std::endl;
+          std::cout << cech_stree.num_simplices() << ";";
+          std::cout << std::boolalpha << (parallel_cech_stree == cech_stree) << ";" << std::endl;
         }
       }
     }
@@ -25,6 +25,12 @@ struct SimplicialComplexForCech {
   typedef unspecified Vertex_handle;
   /** Handle to specify the simplex filtration value. */
   typedef unspecified Filtration_value;
+  /** Key associated to each simplex. Must be an integer type. */
+  typedef unspecified Simplex_key;
+  /** Range over the vertices of a simplex. */
+  typedef unspecified Simplex_vertex_range;
+  /** Range over the simplices of a skeleton. */
+  typedef unspecified Skeleton_simplex_range;
 
   /** Assigns the 'simplex' with the given 'filtration' value. */
   int assign_filtration(Simplex_handle simplex, Filtration_value filtration);
@@ -33,6 +39,25 @@ struct SimplicialComplexForCech {
    *  simplex. */
   Simplex_vertex_range simplex_vertex_range(Simplex_handle const & simplex);
 
+  /** \brief Returns a range over the facets of a given simplex, the i-th facet being the simplex without the i-th
+   * vertex of `simplex_vertex_range(simplex)`. */
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle const & simplex);
+
+  /** \brief Returns a range over the simplices of dimension at most `dim`. */
+  Skeleton_simplex_range skeleton_simplex_range(int dim);
+
+  /** Returns the dimension of a simplex. */
+  int dimension(Simplex_handle simplex);
+
+  /** Returns the key associated to a simplex. */
+  Simplex_key key(Simplex_handle simplex);
+
+  /** Assigns the 'simplex' with the given 'key'. */
+  void assign_key(Simplex_handle simplex, Simplex_key key);
+
+  /** Returns the key of the simplices whose key has never been assigned. */
+  static Simplex_key null_key();
+
   /** \brief Inserts a given `Gudhi::ProximityGraph` in the simplicial complex. */
   template<class ProximityGraph>
   void insert_graph(const ProximityGraph& proximity_graph);
@@ -42,6 +67,12 @@ struct SimplicialComplexForCech {
   template< typename Blocker >
   void expansion_with_blockers(int max_dim, Blocker block_simplex);
 
+  /** \brief Same as `expansion_with_blockers`, where the blocker oracle may be called concurrently on the simplices
+   * of a given dimension, once all the simplices of lower dimension are inserted. Only required by
+   * `Cech_complex::create_complex_parallel`. */
+  template< typename Blocker >
+  void parallel_expansion_with_blockers(int max_dim, Blocker block_simplex);
+
   /** Returns the number of vertices in the simplicial complex. */
   std::size_t num_vertices();
 
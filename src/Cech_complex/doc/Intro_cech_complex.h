@@ -66,6 +66,11 @@ namespace cech_complex {
  * Please refer to
  * <a target="_blank" href="https://people.inf.ethz.ch/gaertner/subdir/texts/own_work/esa99_final.pdf">
  * the miniball software design description</a> for more information about this computation.
+ * The minimal enclosing ball of each simplex is kept during the expansion: when the vertex of a simplex that is not in
+ * one of its facets lies in the minimal enclosing ball of this facet, both simplices have the same ball, and the
+ * miniball computation is skipped.
+ * `Cech_complex::create_complex_parallel` computes the minimal enclosing balls of the simplices of a given dimension
+ * in parallel when GUDHI is built with TBB, and builds the same complex.
  *
  * This radius computation is the reason why the Cech_complex is taking much more time to be computed than the
  * \ref rips_complex but it offers more topological guarantees.
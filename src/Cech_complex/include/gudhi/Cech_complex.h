@@ -16,6 +16,10 @@
 #include <gudhi/Debug_utils.h>               // for GUDHI_CHECK
 #include <gudhi/Cech_complex_blocker.h>      // for Gudhi::cech_complex::Cech_blocker
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/concurrent_vector.h>
+#endif
+
 #include <iostream>
 #include <stdexcept>  // for exception management
 #include <vector>
@@ -82,6 +86,8 @@ class Cech_complex {
    *
    * @param[in] complex SimplicialComplexForCech to be created.
    * @param[in] dim_max graph expansion until this given maximal dimension.
+   *
+   * The keys of the simplices are used during the expansion, and their values are unspecified afterwards.
    * @exception std::invalid_argument In debug mode, if `complex.num_vertices()` does not return 0.
    *
    */
@@ -92,9 +98,46 @@ class Cech_complex {
 
     // insert the proximity graph in the simplicial complex
     complex.insert_graph(cech_skeleton_graph_);
+    // cache of the minimal enclosing balls of the simplices, released once the complex is created
+    Enclosing_ball_cache<Coordinate> balls(point_cloud_.empty() ? 0 : point_cloud_[0].size());
+    cache_edge_balls(complex, balls);
     // expand the graph until dimension dim_max
-    complex.expansion_with_blockers(dim_max,
-                                    Cech_blocker<SimplicialComplexForCechComplex, Cech_complex>(&complex, this));
+    complex.expansion_with_blockers(
+        dim_max, Cech_blocker<SimplicialComplexForCechComplex, Cech_complex, decltype(balls)>(&complex, this, &balls));
+  }
+
+  /** \brief Parallel version of `create_complex`.
+   *
+   * The graph is expanded one dimension at a time, with
+   * `SimplicialComplexForCech::parallel_expansion_with_blockers`: the minimal enclosing balls of the simplices of a
+   * dimension, and so their filtration values, are computed in parallel if GUDHI is built with TBB. The resulting
+   * complex is the same as with `create_complex`.
+   *
+   * @param[in] complex SimplicialComplexForCech to be created.
+   * @param[in] dim_max graph expansion until this given maximal dimension.
+   *
+   * The keys of the simplices are used during the expansion, and their values are unspecified afterwards.
+   * @exception std::invalid_argument In debug mode, if `complex.num_vertices()` does not return 0.
+   *
+   */
+  template <typename SimplicialComplexForCechComplex>
+  void create_complex_parallel(SimplicialComplexForCechComplex& complex, int dim_max) {
+    GUDHI_CHECK(complex.num_vertices() == 0,
+                std::invalid_argument("Cech_complex::create_complex_parallel - simplicial complex is not empty"));
+
+    // insert the proximity graph in the simplicial complex
+    complex.insert_graph(cech_skeleton_graph_);
+    // cache of the minimal enclosing balls of the simplices, where balls are added concurrently
+#ifdef GUDHI_USE_TBB
+    Enclosing_ball_cache<Coordinate, tbb::concurrent_vector<Coordinate>> balls(
+        point_cloud_.empty() ? 0 : point_cloud_[0].size());
+#else
+    Enclosing_ball_cache<Coordinate> balls(point_cloud_.empty() ? 0 : point_cloud_[0].size());
+#endif
+    cache_edge_balls(complex, balls);
+    // expand the graph until dimension dim_max, one dimension at a time
+    complex.parallel_expansion_with_blockers(
+        dim_max, Cech_blocker<SimplicialComplexForCechComplex, Cech_complex, decltype(balls)>(&complex, this, &balls));
   }
 
   /** @return max_radius value given at construction. */
@@ -106,6 +149,19 @@ class Cech_complex {
   const Point& get_point(Vertex_handle vertex) const { return point_cloud_[vertex]; }
 
  private:
+  // Caches the minimal enclosing ball of each edge, once and before the expansion, so that the blocker only reads
+  // the keys of the facets of the simplices it is called on.
+  template <typename SimplicialComplexForCechComplex, typename Ball_cache>
+  void cache_edge_balls(SimplicialComplexForCechComplex& complex, Ball_cache& balls) const {
+    for (auto sh : complex.skeleton_simplex_range(1)) {
+      if (complex.dimension(sh) != 1) continue;
+      auto vertex = complex.simplex_vertex_range(sh).begin();
+      const Point& point_1 = get_point(*vertex++);
+      const Point& point_2 = get_point(*vertex);
+      complex.assign_key(sh, balls.push_back(point_1, point_2));
+    }
+  }
+
   Proximity_graph cech_skeleton_graph_;
   Filtration_value max_radius_;
   Point_cloud point_cloud_;
@@ -11,16 +11,97 @@
 #ifndef CECH_COMPLEX_BLOCKER_H_
 #define CECH_COMPLEX_BLOCKER_H_
 
-#include <gudhi/distance_functions.h>  // for Gudhi::Minimal_enclosing_ball_radius
+#include <gudhi/Miniball.hpp>
+#include <gudhi/Debug_utils.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/concurrent_vector.h>
+#endif
 
 #include <iostream>
 #include <vector>
 #include <cmath>  // for std::sqrt
+#include <cstddef>  // for std::size_t
+#include <stdexcept>  // for std::logic_error
 
 namespace Gudhi {
 
 namespace cech_complex {
 
+/** \internal \brief Appends n values to a storage of Enclosing_ball_cache, and returns the index of the first one. */
+template <typename Coordinate>
+std::size_t grow_by(std::vector<Coordinate>& storage, std::size_t n) {
+  storage.resize(storage.size() + n);
+  return storage.size() - n;
+}
+
+#ifdef GUDHI_USE_TBB
+template <typename Coordinate>
+std::size_t grow_by(tbb::concurrent_vector<Coordinate>& storage, std::size_t n) {
+  return storage.grow_by(n) - storage.begin();
+}
+#endif
+
+/** \internal
+ * \class Enclosing_ball_cache
+ * \brief Minimal enclosing balls of the simplices of a Čech complex, indexed by the key of the simplices.
+ *
+ * \ingroup cech_complex
+ *
+ * \details
+ * Each ball is stored as the coordinates of its center followed by its squared radius, contiguously in a single
+ * storage, in order not to allocate memory for each ball. With a `tbb::concurrent_vector` storage, balls can be added
+ * concurrently, and read while others are added.
+ */
+template <typename Coordinate, typename Storage = std::vector<Coordinate>>
+class Enclosing_ball_cache {
+ public:
+  /** \internal \brief Constructor from the dimension of the points. */
+  explicit Enclosing_ball_cache(std::size_t dimension) : dimension_(dimension) {}
+
+  /** \internal \brief Adds a ball from an iterator on the coordinates of its center, and returns its index. */
+  template <typename Coordinate_iterator>
+  std::size_t push_back(Coordinate_iterator center, Coordinate squared_radius) {
+    std::size_t first = grow_by(storage_, dimension_ + 1);
+    for (std::size_t i = 0; i < dimension_; ++i) storage_[first + i] = *center++;
+    storage_[first + dimension_] = squared_radius;
+    return first / (dimension_ + 1);
+  }
+
+  /** \internal \brief Adds the minimal enclosing ball of two points, and returns its index. */
+  template <typename Point>
+  std::size_t push_back(const Point& point_1, const Point& point_2) {
+    std::size_t first = grow_by(storage_, dimension_ + 1);
+    Coordinate squared_diameter = 0;
+    auto it_1 = point_1.begin(), it_2 = point_2.begin();
+    for (std::size_t i = 0; i < dimension_; ++i, ++it_1, ++it_2) {
+      storage_[first + i] = (*it_1 + *it_2) / 2;
+      squared_diameter += (*it_1 - *it_2) * (*it_1 - *it_2);
+    }
+    storage_[first + dimension_] = squared_diameter / 4;
+    return first / (dimension_ + 1);
+  }
+
+  /** \internal \brief Returns the squared radius of the ball of the given index. */
+  Coordinate squared_radius(std::size_t index) const { return storage_[index * (dimension_ + 1) + dimension_]; }
+
+  /** \internal \brief Returns whether a point is in the (closed) ball of the given index. */
+  template <typename Point>
+  bool contains(std::size_t index, const Point& point) const {
+    std::size_t center = index * (dimension_ + 1);
+    Coordinate squared_distance = 0;
+    for (auto coordinate : point) {
+      Coordinate difference = coordinate - storage_[center++];
+      squared_distance += difference * difference;
+    }
+    return squared_distance <= storage_[center];
+  }
+
+ private:
+  std::size_t dimension_;
+  Storage storage_;
+};
+
 /** \internal
  * \class Cech_blocker
  * \brief Čech complex blocker.
@@ -30,34 +111,63 @@ namespace cech_complex {
  * \details
  * Čech blocker is an oracle constructed from a Cech_complex and a simplicial complex.
  *
- * \tparam SimplicialComplexForProximityGraph furnishes `Simplex_handle` and `Filtration_value` type definition,
- * `simplex_vertex_range(Simplex_handle sh)`and `assign_filtration(Simplex_handle sh, Filtration_value filt)` methods.
+ * The minimal enclosing ball of each simplex is cached, and the key of the simplex is set to its index in the cache.
+ * The balls of the edges must be cached before the expansion. The minimal enclosing ball of a simplex is the one of
+ * its facet when the opposite vertex lies in the latter, and is only computed from scratch, with Miniball, otherwise.
+ *
+ * The blocker only modifies the simplex it is called on, it can be called concurrently on different simplices of the
+ * same dimension if the cache supports concurrent additions.
+ *
+ * \tparam SimplicialComplexForProximityGraph furnishes `Simplex_handle`, `Vertex_handle`, `Simplex_key` and
+ * `Filtration_value` type definition, `simplex_vertex_range(Simplex_handle sh)`,
+ * `boundary_simplex_range(Simplex_handle sh)`, `assign_filtration(Simplex_handle sh, Filtration_value filt)`,
+ * `key(Simplex_handle sh)`, `assign_key(Simplex_handle sh, Simplex_key key)` and `null_key()` methods.
  *
  * \tparam Chech_complex is required by the blocker.
+ *
+ * \tparam Ball_cache is an Enclosing_ball_cache.
  */
-template <typename SimplicialComplexForCech, typename Cech_complex>
+template <typename SimplicialComplexForCech, typename Cech_complex, typename Ball_cache>
 class Cech_blocker {
  private:
-  using Point_cloud = typename Cech_complex::Point_cloud;
+  using Point = typename Cech_complex::Point;
 
   using Simplex_handle = typename SimplicialComplexForCech::Simplex_handle;
+  using Vertex_handle = typename SimplicialComplexForCech::Vertex_handle;
+  using Simplex_key = typename SimplicialComplexForCech::Simplex_key;
   using Filtration_value = typename SimplicialComplexForCech::Filtration_value;
 
+  // Gives Miniball the coordinates of the points of a simplex without copying them
+  struct Vertex_coordinate_accessor {
+    typedef typename std::vector<Vertex_handle>::const_iterator Pit;
+    typedef typename Point::const_iterator Cit;
+    Cit operator()(Pit it) const { return cc_ptr_->get_point(*it).begin(); }
+    const Cech_complex* cc_ptr_;
+  };
+
  public:
   /** \internal \brief Čech complex blocker operator() - the oracle - assigns the filtration value from the simplex
    * radius and returns if the simplex expansion must be blocked.
    *  \param[in] sh The Simplex_handle.
    *  \return true if the simplex radius is greater than the Cech_complex max_radius*/
   bool operator()(Simplex_handle sh) {
-    Point_cloud points;
-    for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) {
-      points.push_back(cc_ptr_->get_point(vertex));
-#ifdef DEBUG_TRACES
-      std::cout << "#(" << vertex << ")#";
-#endif  // DEBUG_TRACES
+    Simplex_key ball_key = sc_ptr_->null_key();
+    // The i-th facet of the boundary is the simplex without its i-th vertex
+    auto opposite_vertex = sc_ptr_->simplex_vertex_range(sh).begin();
+    for (auto facet : sc_ptr_->boundary_simplex_range(sh)) {
+      const Point& opposite_point = cc_ptr_->get_point(*opposite_vertex++);
+      Simplex_key facet_key = sc_ptr_->key(facet);
+      GUDHI_CHECK(facet_key != sc_ptr_->null_key(), std::logic_error("Cech_blocker - facet without a cached ball"));
+      if (balls_ptr_->contains(facet_key, opposite_point)) {
+        ball_key = facet_key;
+        break;
+      }
     }
-    Filtration_value radius = Gudhi::Minimal_enclosing_ball_radius()(points);
+    if (ball_key == sc_ptr_->null_key()) ball_key = compute_ball(sh);
+    sc_ptr_->assign_key(sh, ball_key);
+    Filtration_value radius = std::sqrt(balls_ptr_->squared_radius(ball_key));
 #ifdef DEBUG_TRACES
+    for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) std::cout << "#(" << vertex << ")#";
     if (radius > cc_ptr_->max_radius()) std::cout << "radius > max_radius => expansion is blocked\n";
 #endif  // DEBUG_TRACES
     sc_ptr_->assign_filtration(sh, radius);
@@ -65,11 +175,25 @@ class Cech_blocker {
   }
 
   /** \internal \brief Čech complex blocker constructor. */
-  Cech_blocker(SimplicialComplexForCech* sc_ptr, Cech_complex* cc_ptr) : sc_ptr_(sc_ptr), cc_ptr_(cc_ptr) {}
+  Cech_blocker(SimplicialComplexForCech* sc_ptr, Cech_complex* cc_ptr, Ball_cache* balls_ptr)
+      : sc_ptr_(sc_ptr), cc_ptr_(cc_ptr), balls_ptr_(balls_ptr) {}
 
  private:
+  /** \internal \brief Computes the minimal enclosing ball of a simplex with Miniball, caches it and returns its index
+   * in the cache. */
+  Simplex_key compute_ball(Simplex_handle sh) {
+    // Miniball requires default constructible point iterators, vertex handles are only copied here
+    std::vector<Vertex_handle> vertices;
+    for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) vertices.push_back(vertex);
+    Miniball::Miniball<Vertex_coordinate_accessor> ms(static_cast<int>(cc_ptr_->get_point(vertices[0]).size()),
+                                                      vertices.cbegin(), vertices.cend(),
+                                                      Vertex_coordinate_accessor{cc_ptr_});
+    return balls_ptr_->push_back(ms.center(), ms.squared_radius());
+  }
+
   SimplicialComplexForCech* sc_ptr_;
   Cech_complex* cc_ptr_;
+  Ball_cache* balls_ptr_;
 };
 
 }  // namespace cech_complex
@@ -14,9 +14,11 @@
 
 #include <cmath>  // float comparison
 #include <limits>
+#include <random>
 #include <string>
 #include <vector>
 #include <algorithm>  // std::max
+#include <utility>  // std::pair
 
 #include <gudhi/Cech_complex.h>
 // to construct Cech_complex from a OFF file of points
@@ -227,6 +229,105 @@ BOOST_AUTO_TEST_CASE(Cech_complex_from_points) {
   }
 }
 
+// Checks the filtration value of every simplex against its minimal enclosing ball computed from scratch
+void check_filtrations_against_miniball(Simplex_tree& st, const Point_cloud& points, Filtration_value max_radius,
+                                        Filtration_value epsilon = 1e-10) {
+  for (auto f_simplex : st.complex_simplex_range()) {
+    Point_cloud simplex_points;
+    for (auto vertex : st.simplex_vertex_range(f_simplex)) simplex_points.push_back(points[vertex]);
+    Filtration_value radius = 0.;
+    if (simplex_points.size() > 1) radius = Gudhi::Minimal_enclosing_ball_radius()(simplex_points);
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(st.filtration(f_simplex), radius, epsilon);
+    BOOST_CHECK(st.filtration(f_simplex) <= max_radius);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Cech_complex_parallel) {
+  // ----------------------------------------------------------------------------
+  // Init of a list of random points
+  // ----------------------------------------------------------------------------
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<Filtration_value> coordinate(0., 1.);
+  Point_cloud points;
+  for (int i = 0; i < 150; i++) points.push_back({coordinate(gen), coordinate(gen), coordinate(gen)});
+
+  for (Filtration_value max_radius : {0.1, 0.15, 0.2}) {
+    Cech_complex cech_complex_from_points(points, max_radius);
+    Simplex_tree st;
+    cech_complex_from_points.create_complex(st, 4);
+    Simplex_tree parallel_st;
+    cech_complex_from_points.create_complex_parallel(parallel_st, 4);
+
+    std::cout << "Cech_complex_parallel - max_radius=" << max_radius << " - st.num_simplices()=" << st.num_simplices()
+              << " - parallel_st.num_simplices()=" << parallel_st.num_simplices() << std::endl;
+    BOOST_CHECK(parallel_st.num_simplices() == st.num_simplices());
+    BOOST_CHECK(parallel_st.dimension() == st.dimension());
+    // Same simplices with the same filtration values
+    BOOST_CHECK(parallel_st == st);
+    check_filtrations_against_miniball(parallel_st, points, max_radius);
+  }
+}
+
+// Builds the Cech complex and checks the filtration value of every simplex against Miniball
+void check_filtrations_against_miniball(const Point_cloud& points, Filtration_value max_radius, int dim_max,
+                                        Filtration_value epsilon = 1e-10) {
+  Cech_complex cech_complex_from_points(points, max_radius);
+  Simplex_tree st;
+  cech_complex_from_points.create_complex(st, dim_max);
+  std::cout << "check_filtrations_against_miniball - " << points.size() << " points in dimension "
+            << points[0].size() << " - max_radius=" << max_radius << " - st.num_simplices()=" << st.num_simplices()
+            << std::endl;
+  check_filtrations_against_miniball(st, points, max_radius, epsilon);
+}
+
+BOOST_AUTO_TEST_CASE(Cech_complex_cached_balls) {
+  // ----------------------------------------------------------------------------
+  // Random points, whose balls are mostly reused from a facet
+  // ----------------------------------------------------------------------------
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<Filtration_value> coordinate(0., 1.);
+  for (auto dimension_and_radius : {std::make_pair(2, 0.15), std::make_pair(3, 0.25), std::make_pair(5, 0.4)}) {
+    Point_cloud points(60, Point(dimension_and_radius.first));
+    for (auto& point : points)
+      for (auto& x : point) x = coordinate(gen);
+    check_filtrations_against_miniball(points, dimension_and_radius.second, 4);
+  }
+
+  // ----------------------------------------------------------------------------
+  // Cospherical points, where the opposite vertex is on the boundary of the ball of a facet
+  // ----------------------------------------------------------------------------
+  // Regular 12-gon, with many right triangles
+  Point_cloud polygon;
+  const Filtration_value pi = std::acos(-1.);
+  for (int i = 0; i < 12; i++) polygon.push_back({std::cos(i * pi / 6.), std::sin(i * pi / 6.)});
+  check_filtrations_against_miniball(polygon, 2., 3);
+  // Vertices of a cube, with cospherical and coplanar faces
+  Point_cloud cube;
+  for (int i = 0; i < 8; i++) cube.push_back({i & 1 ? 1. : -1., i & 2 ? 1. : -1., i & 4 ? 1. : -1.});
+  check_filtrations_against_miniball(cube, 2., 4);
+  // Vertices of the 24-cell, on the unit sphere of dimension 4
+  Point_cloud cell_24;
+  for (int i = 0; i < 4; i++) {
+    for (Filtration_value sign : {-1., 1.}) {
+      Point point(4, 0.);
+      point[i] = sign;
+      cell_24.push_back(point);
+    }
+  }
+  for (int i = 0; i < 16; i++)
+    cell_24.push_back({i & 1 ? .5 : -.5, i & 2 ? .5 : -.5, i & 4 ? .5 : -.5, i & 8 ? .5 : -.5});
+  check_filtrations_against_miniball(cell_24, 0.9, 4);
+  // The same points, slightly perturbed. Miniball itself is then only accurate up to a relative error of a few 1e-9.
+  std::uniform_real_distribution<Filtration_value> noise(-1e-9, 1e-9);
+  for (Point_cloud* points : {&polygon, &cube, &cell_24}) {
+    for (auto& point : *points)
+      for (auto& x : point) x += noise(gen);
+  }
+  check_filtrations_against_miniball(polygon, 2., 3, 1e-8);
+  check_filtrations_against_miniball(cube, 2., 4, 1e-8);
+  check_filtrations_against_miniball(cell_24, 0.9, 4, 1e-8);
+}
+
 #ifdef GUDHI_DEBUG
 BOOST_AUTO_TEST_CASE(Cech_create_complex_throw) {
   // ----------------------------------------------------------------------------
@@ -14,9 +14,12 @@
 #include <gudhi/allocator.h>
 
 #include <boost/iterator/counting_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <algorithm>
-#include <utility>  // for pair
+#include <iostream>
+#include <utility>  // for pair, move
+#include <iterator>  // for begin, end, distance
 #include <vector>
 #include <limits>  // for infinity value
 
@@ -43,10 +46,10 @@ struct Hasse_simplex {
 
   Hasse_simplex(typename HasseCpx::Simplex_key key
                 , typename HasseCpx::Filtration_value fil
-                , std::vector<typename HasseCpx::Simplex_handle> const& boundary)
+                , std::vector<typename HasseCpx::Simplex_handle> boundary)
       : key_(key)
       , filtration_(fil)
-      , boundary_(boundary) { }
+      , boundary_(std::move(boundary)) { }
 
   typename HasseCpx::Simplex_key key_;
   typename HasseCpx::Filtration_value filtration_;
@@ -116,6 +119,43 @@ class Hasse_complex {
       , num_vertices_(0)
       , dim_max_(-1) { }
 
+  /* Builds the complex from the boundaries and the filtration values of its simplices, in the order of the
+   * filtration. The boundary of a simplex is the range of the handles (i.e. the positions in the lists) of its
+   * facets, and is empty for a vertex. */
+  template < class BoundaryRange, class FiltrationRange >
+  Hasse_complex(const BoundaryRange & boundaries, const FiltrationRange & filtrations)
+      : Hasse_complex() {
+    reserve(std::distance(std::begin(boundaries), std::end(boundaries)));
+    auto fil_it = std::begin(filtrations);
+    for (auto & boundary : boundaries) {
+      insert_simplex(boundary, *fil_it);
+      ++fil_it;
+    }
+  }
+
+  /* Reserves memory for num_simp simplices. */
+  void reserve(size_t num_simp) {
+    complex_.reserve(num_simp);
+  }
+
+  /* Appends a simplex, given the handles of its facets (none for a vertex) and its filtration value, and returns
+   * its handle, which is also its key. The simplices must be appended in the order of the filtration, so a simplex
+   * comes after its facets. */
+  template < class BoundaryRange >
+  Simplex_handle insert_simplex(const BoundaryRange & boundary, Filtration_value fil) {
+    Simplex_handle sh = complex_.size();
+    complex_.emplace_back(sh, fil, std::vector<Simplex_handle>(std::begin(boundary), std::end(boundary)));
+    int dim = dimension(sh);
+    if (dim == 0) {
+      vertices_.push_back(sh);
+      ++num_vertices_;
+    }
+    if (dim_max_ < dim) {
+      dim_max_ = dim;
+    }
+    return sh;
+  }
+
   size_t num_simplices() {
     return complex_.size();
   }
@@ -0,0 +1,102 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Points_off_io.h>
+
+#include <chrono>
+#include <cstdlib>  // for std::atoi, std::atof
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Types definition
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Bitmap_cubical_complex_base = Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>;
+using Bitmap_cubical_complex = Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_base>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Intrusive_column_storage = Gudhi::persistent_cohomology::Intrusive_column_storage;
+using Flat_column_storage = Gudhi::persistent_cohomology::Flat_column_storage;
+using Point = std::vector<double>;
+using Points_off_reader = Gudhi::Points_off_reader<Point>;
+
+/* Compute the persistent homology of the complex cpx with coefficients in Z/pZ, with the given storage for the
+ * columns of the compressed annotation matrix. Returns the number of persistence intervals. */
+template<typename ColumnStorage, typename FilteredComplex>
+std::size_t timing_persistence(FilteredComplex & cpx, int p, const std::string& storage_name) {
+  std::chrono::time_point<std::chrono::system_clock> start, end;
+  std::size_t number_of_intervals;
+  start = std::chrono::system_clock::now();
+  {
+    Gudhi::persistent_cohomology::Persistent_cohomology<FilteredComplex, Field_Zp, ColumnStorage> pcoh(cpx);
+    pcoh.init_coefficients(p);
+    pcoh.compute_persistent_cohomology();
+    number_of_intervals = pcoh.get_persistent_pairs().size();
+  }
+  end = std::chrono::system_clock::now();
+  int elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+  std::cout << "  " << storage_name << " columns: persistent homology in Z/" << p << "Z in " << elapsed_ms
+      << " ms (" << number_of_intervals << " intervals, destructors included).\n";
+  return number_of_intervals;
+}
+
+template<typename FilteredComplex>
+void compare_column_storages(FilteredComplex & cpx, int p) {
+  std::size_t intrusive_intervals = timing_persistence<Intrusive_column_storage>(cpx, p, "Intrusive");
+  std::size_t flat_intervals = timing_persistence<Flat_column_storage>(cpx, p, "Flat");
+  if (intrusive_intervals != flat_intervals)
+    std::cerr << "  Error: different number of intervals.\n";
+}
+
+/* Timings of the computation of persistent homology with the two column storage policies of the compressed
+ * annotation matrix: intrusive linked lists of cells and contiguous sorted vectors.
+ * The inputs are a Rips complex built on a set of points sampling a Klein bottle embedded in dimension 5, and a
+ * 3-dimensional cubical complex with random filtration values on its top dimensional cells.
+ *
+ * Usage: performance_column_storage [off_file [threshold [dim_max [bitmap_size]]]]
+ */
+int main(int argc, char * argv[]) {
+  std::string off_file_points = argc > 1 ? argv[1] : "Kl.off";
+  Filtration_value threshold = argc > 2 ? std::atof(argv[2]) : 0.25;
+  int dim_max = argc > 3 ? std::atoi(argv[3]) : 3;
+  unsigned bitmap_size = argc > 4 ? std::atoi(argv[4]) : 64;
+  int p = 2;
+  int q = 1223;
+
+  {
+    Points_off_reader off_reader(off_file_points);
+    Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+    Simplex_tree st;
+    rips_complex_from_file.create_complex(st, dim_max);
+    st.initialize_filtration();
+    std::cout << "Rips complex of " << off_file_points << " with threshold " << threshold << ": dimension "
+        << st.dimension() << " - " << st.num_simplices() << " simplices\n";
+    compare_column_storages(st, p);
+    compare_column_storages(st, q);
+  }
+
+  {
+    std::vector<unsigned> sizes(3, bitmap_size);
+    std::vector<double> data(bitmap_size * bitmap_size * bitmap_size);
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> dist(0., 1.);
+    for (auto& value : data) value = dist(gen);
+    Bitmap_cubical_complex cubical_complex(sizes, data);
+    std::cout << "Random cubical complex of size " << bitmap_size << "^3: " << cubical_complex.num_simplices()
+        << " cubes\n";
+    compare_column_storages(cubical_complex, p);
+    compare_column_storages(cubical_complex, q);
+  }
+  return 0;
+}
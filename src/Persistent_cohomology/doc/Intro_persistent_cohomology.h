@@ -127,6 +127,24 @@ namespace persistent_cohomology {
  by increasing filtration values (breaking ties so as a simplex appears after
  its subsimplices of same filtration value) provides an indexing scheme.
 
+ \section pcohclearing Clearing and apparent pairs
+ `Persistent_cohomology::compute_persistent_cohomology_with_clearing()` is an alternative to the compressed
+ annotation matrix, for coefficient fields with a single characteristic. It reduces the coboundary matrix dimension
+ by dimension, in the reverse order of the filtration, which allows to skip the simplices that already kill a class of
+ lower dimension (<EM>clearing</EM>) and to pair a simplex with its oldest cofacet without any column operation,
+ when it is the youngest facet of this cofacet (<EM>apparent pairs</EM>). On Rips and alpha filtrations, most of the
+ persistence pairs are apparent pairs of zero length.
+
+ `Persistent_cohomology::compute_persistent_cohomology_parallel()` splits the same reduction in chunks of consecutive
+ simplices, that are first reduced independently in parallel (with TBB), before a global reduction of the columns
+ that remain unpaired.
+
+ \section pcohhomology Persistent homology
+ `Persistent_homology` computes the same persistence intervals as `Persistent_cohomology`, and provides the same
+ queries on them, by reducing the boundary matrix of the complex with the twist algorithm. The boundaries of all the
+ simplices are stored, but cubical complexes, whose boundary matrices are sparse and cheap to build, are often
+ processed faster this way than by the compressed annotation matrix.
+
 \section pcohexamples Examples
 
 We provide several example files: run these examples with -h for details on their use, and read the README file.
@@ -11,20 +11,24 @@
 #ifndef PERSISTENT_COHOMOLOGY_H_
 #define PERSISTENT_COHOMOLOGY_H_
 
-#include <gudhi/Persistent_cohomology/Persistent_cohomology_column.h>
+#include <gudhi/Persistent_cohomology/Annotation_matrix.h>
 #include <gudhi/Persistent_cohomology/Field_Zp.h>
-#include <gudhi/Simple_object_pool.h>
 
-#include <boost/intrusive/set.hpp>
 #include <boost/pending/disjoint_sets.hpp>
-#include <boost/intrusive/list.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
 
 #include <map>
 #include <utility>
 #include <list>
 #include <vector>
 #include <set>
+#include <queue>
 #include <fstream>  // std::ofstream
+#include <iostream>  // std::cout
 #include <limits>  // for numeric_limits<>
 #include <tuple>
 #include <algorithm>
@@ -44,11 +48,13 @@ namespace persistent_cohomology {
  * and is adapted to the computation of Multi-Field Persistent Homology (MF)
  * \cite boissonnat:hal-00922572 .
  *
+ * The storage of the columns of the CAM is selected at compile time with `ColumnStorage`, either
+ * `Intrusive_column_storage` (default) or `Flat_column_storage`.
+ *
  * \implements PersistentHomology
  *
  */
-// TODO(CM): Memory allocation policy: classic, use a mempool, etc.
-template<class FilteredComplex, class CoefficientField>
+template<class FilteredComplex, class CoefficientField, class ColumnStorage = Intrusive_column_storage>
 class Persistent_cohomology {
  public:
   // Data attached to each simplex to interface with a Property Map.
@@ -66,20 +72,11 @@ class Persistent_cohomology {
   typedef std::tuple<Simplex_handle, Simplex_handle, Arith_element> Persistent_interval;
 
  private:
-  // Compressed Annotation Matrix types:
-  // Column type
-  typedef Persistent_cohomology_column<Simplex_key, Arith_element> Column;  // contains 1 set_hook
-  // Cell type
-  typedef typename Column::Cell Cell;   // contains 2 list_hooks
-  // Remark: constant_time_size must be false because base_hook_cam_h has auto_unlink link_mode
-  typedef boost::intrusive::list<Cell,
-      boost::intrusive::constant_time_size<false>,
-      boost::intrusive::base_hook<base_hook_cam_h> > Hcell;
-
-  typedef boost::intrusive::set<Column,
-      boost::intrusive::constant_time_size<false> > Cam;
+  // Compressed Annotation Matrix type
+  typedef typename ColumnStorage::template Annotation_matrix<Simplex_key, Arith_element, CoefficientField> Cam;
+  typedef typename Cam::Column_handle Column_handle;
   // Sparse column type for the annotation of the boundary of an element.
-  typedef std::vector<std::pair<Simplex_key, Arith_element> > A_ds_type;
+  typedef typename Cam::A_ds_type A_ds_type;
 
  public:
   /** \brief Initializes the Persistent_cohomology class.
@@ -99,15 +96,12 @@ class Persistent_cohomology {
         num_simplices_(cpx_->num_simplices()),           // num_simplices save to avoid to call thrice the function
         ds_rank_(num_simplices_),                        // union-find
         ds_parent_(num_simplices_),                      // union-find
-        ds_repr_(num_simplices_, NULL),                  // union-find -> annotation vectors
+        ds_repr_(num_simplices_, Cam::null_column()),    // union-find -> annotation vectors
         dsets_(&ds_rank_[0], &ds_parent_[0]),            // union-find
-        cam_(),                                          // collection of annotation vectors
+        cam_(&coeff_field_),                             // collection of annotation vectors
         zero_cocycles_(),                                // union-find -> Simplex_key of creator for 0-homology
-        transverse_idx_(),                               // key -> row
         persistent_pairs_(),
-        interval_length_policy(&cpx, 0),
-        column_pool_(),  // memory pools for the CAM
-        cell_pool_() {
+        interval_length_policy(&cpx, 0) {
     if (cpx_->num_simplices() > std::numeric_limits<Simplex_key>::max()) {
       // num_simplices must be strictly lower than the limit, because a value is reserved for null_key.
       throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
@@ -123,15 +117,6 @@ class Persistent_cohomology {
     }
   }
 
-  ~Persistent_cohomology() {
-    // Clean the transversal lists
-    for (auto & transverse_ref : transverse_idx_) {
-      // Destruct all the cells
-      transverse_ref.second.row_->clear_and_dispose([&](Cell*p){p->~Cell();});
-      delete transverse_ref.second.row_;
-    }
-  }
-
  private:
   struct length_interval {
     length_interval(FilteredComplex * cpx, Filtration_value min_length)
@@ -201,13 +186,378 @@ class Persistent_cohomology {
           cpx_->simplex(zero_idx.second), cpx_->null_simplex(), coeff_field_.characteristic());
     }
     // Compute infinite interval of dimension > 0
-    for (auto cocycle : transverse_idx_) {
-      persistent_pairs_.emplace_back(
-          cpx_->simplex(cocycle.first), cpx_->null_simplex(), cocycle.second.characteristics_);
+    cam_.for_each_cocycle([this](Simplex_key key, Arith_element characteristics) {
+      persistent_pairs_.emplace_back(cpx_->simplex(key), cpx_->null_simplex(), characteristics);
+    });
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial
+   * complex, by reducing the coboundary matrix dimension by dimension, in the reverse order of the filtration.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   *
+   * Two optimizations allow to skip most of the simplices of a Rips or an alpha filtration without any column
+   * operation:
+   * - apparent pairs: if a simplex is the youngest facet of its oldest cofacet, they form a persistence pair and the
+   * column is not reduced,
+   * - clearing: a simplex that kills a cohomology class of dimension \f$d\f$ is not processed as a column
+   * when computing the cohomology of dimension \f$d+1\f$, as its reduced column is known to be zero.
+   *
+   * The coboundaries are stored explicitly, with the keys of the cofacets, instead of the compressed annotation
+   * matrix.
+   *
+   * The persistent pairs are the same as the ones of `compute_persistent_cohomology()`, up to the choice of the
+   * simplices for intervals with the same filtration values.
+   *
+   * Assumes that the filtration provided by the simplicial complex is
+   * valid. Undefined behavior otherwise. Only available for a coefficient field with a single characteristic, like
+   * `Field_Zp`. */
+  void compute_persistent_cohomology_with_clearing(Filtration_value min_interval_length = 0) {
+    interval_length_policy.set_length(min_interval_length);
+    const Simplex_key null_key = cpx_->null_key();
+
+    std::vector<int> dimensions;
+    std::vector<Simplex_key> youngest_facet;
+    std::vector<std::size_t> coboundary_bounds;
+    std::vector<std::pair<Simplex_key, Arith_element>> coboundaries;
+    build_coboundary_matrix(dimensions, youngest_facet, coboundary_bounds, coboundaries);
+
+    // pivot_column[k] is the column whose reduced coboundary has k as pivot, or null_key. It also marks the cleared
+    // columns of the next dimension.
+    std::vector<Simplex_key> pivot_column(num_simplices_, null_key);
+    std::vector<Arith_element> pivot_coefficient(num_simplices_, coeff_field_.additive_identity());
+    // Non trivial cocycle representatives of the reduced columns. The others are reduced to their own simplex.
+    std::map<Simplex_key, A_ds_type> reductions;
+
+    std::vector<Simplex_key> columns_to_reduce;
+    for (int dim = 0; dim < dim_max_; ++dim) {
+      columns_to_reduce.clear();
+      for (std::size_t i = num_simplices_; i-- > 0;) {
+        if (dimensions[i] == dim && pivot_column[i] == null_key)
+          columns_to_reduce.push_back(static_cast<Simplex_key>(i));
+      }
+      for (Simplex_key column : columns_to_reduce) {
+        reduce_coboundary_column(column, coboundaries, coboundary_bounds, youngest_facet, pivot_column,
+                                 pivot_coefficient, reductions);
+      }
+      reductions.clear();
+    }
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial
+   * complex, with a chunked reduction of the coboundary matrix run in parallel.
+   *
+   * @param[in] num_threads maximal number of threads used for the reduction
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   *
+   * The simplices are split in chunks of consecutive keys. In a first phase, every chunk is reduced independently,
+   * only with its own columns, and in parallel. A column whose pivot falls in its chunk is already paired in the
+   * persistence diagram, which is the case of most of the pairs of short length. In a second phase, the other columns
+   * are reduced with all the columns. Both phases proceed dimension by dimension, with the clearing and apparent pairs
+   * optimizations of `compute_persistent_cohomology_with_clearing()`.
+   *
+   * The persistence diagram is the same as the one of `compute_persistent_cohomology()`, up to the choice of the
+   * simplices for intervals with the same filtration values. The chunks are reduced in parallel only if GUDHI is
+   * compiled with TBB.
+   *
+   * Assumes that the filtration provided by the simplicial complex is
+   * valid. Undefined behavior otherwise. Only available for a coefficient field with a single characteristic, like
+   * `Field_Zp`. */
+  void compute_persistent_cohomology_parallel(int num_threads, Filtration_value min_interval_length = 0) {
+    interval_length_policy.set_length(min_interval_length);
+    const Simplex_key null_key = cpx_->null_key();
+
+    std::vector<int> dimensions;
+    std::vector<Simplex_key> youngest_facet;
+    std::vector<std::size_t> coboundary_bounds;
+    std::vector<std::pair<Simplex_key, Arith_element>> coboundaries;
+    build_coboundary_matrix(dimensions, youngest_facet, coboundary_bounds, coboundaries);
+
+    // pivot_column[k] is the column whose reduced coboundary has k as pivot, or null_key.
+    std::vector<Simplex_key> pivot_column(num_simplices_, null_key);
+    // Reduced coboundaries, or partially reduced after the first phase. Left empty for a column that was not modified.
+    std::vector<A_ds_type> reduced_columns(num_simplices_);
+    enum : char { unreduced_column, paired_column, zero_column };
+    std::vector<char> column_status(num_simplices_, unreduced_column);
+
+    // Reduces the column with the columns on its left, as long as its pivot is at most max_pivot.
+    auto reduce_column = [&](Simplex_key column, Simplex_key max_pivot, A_ds_type& working, A_ds_type& buffer) {
+      bool modified = !reduced_columns[column].empty();
+      if (modified) {
+        working.swap(reduced_columns[column]);
+        reduced_columns[column].clear();
+      } else {
+        working.assign(coboundaries.begin() + coboundary_bounds[column],
+                       coboundaries.begin() + coboundary_bounds[column + 1]);
+        // Apparent pair: the oldest cofacet has this simplex as youngest facet.
+        if (!working.empty() && working.front().first <= max_pivot &&
+            youngest_facet[working.front().first] == column) {
+          pivot_column[working.front().first] = column;
+          column_status[column] = paired_column;
+          return;
+        }
+      }
+      while (true) {
+        if (working.empty()) {
+          column_status[column] = zero_column;
+          return;
+        }
+        Simplex_key pivot = working.front().first;
+        if (pivot > max_pivot) {
+          reduced_columns[column].swap(working);
+          return;
+        }
+        Simplex_key other_column = pivot_column[pivot];
+        if (other_column == null_key) {
+          pivot_column[pivot] = column;
+          column_status[column] = paired_column;
+          if (modified) reduced_columns[column].swap(working);
+          return;
+        }
+        auto other_begin = coboundaries.cbegin() + coboundary_bounds[other_column];
+        auto other_end = coboundaries.cbegin() + coboundary_bounds[other_column + 1];
+        if (!reduced_columns[other_column].empty()) {
+          other_begin = reduced_columns[other_column].cbegin();
+          other_end = reduced_columns[other_column].cend();
+        }
+        // working <- working + w * other, to zero-out the pivot.
+        Arith_element w = coeff_field_.times_minus(
+            working.front().second, coeff_field_.inverse(other_begin->second, coeff_field_.characteristic()).first);
+        plus_equal_column(buffer, working, other_begin, other_end, w);
+        working.swap(buffer);
+        modified = true;
+      }
+    };
+
+    // Reduces the unreduced columns of dimension dim with keys in [begin, end), by decreasing key. The columns paired
+    // in lower dimension are cleared.
+    auto reduce_columns = [&](int dim, std::size_t begin, std::size_t end, A_ds_type& working, A_ds_type& buffer) {
+      for (std::size_t i = end; i-- > begin;) {
+        if (dimensions[i] != dim || column_status[i] != unreduced_column) continue;
+        if (pivot_column[i] != null_key) {
+          column_status[i] = zero_column;
+          reduced_columns[i].clear();
+        } else {
+          reduce_column(static_cast<Simplex_key>(i), static_cast<Simplex_key>(end - 1), working, buffer);
+        }
+      }
+    };
+
+    // First phase. A chunk only writes in pivot_column between its first key (excluded) and its last key, because
+    // the pivot of a column is a cofacet, and only reads in its own range. The chunks can be reduced concurrently.
+    std::size_t num_chunks = std::min<std::size_t>(num_simplices_,
+                                                   8 * static_cast<std::size_t>(std::max(num_threads, 1)));
+    auto reduce_chunk = [&](std::size_t chunk) {
+      A_ds_type working, buffer;
+      for (int dim = 0; dim < dim_max_; ++dim)
+        reduce_columns(dim, chunk * num_simplices_ / num_chunks, (chunk + 1) * num_simplices_ / num_chunks,
+                       working, buffer);
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::task_arena arena(std::max(num_threads, 1));
+    arena.execute([&]() { tbb::parallel_for(std::size_t(0), num_chunks, reduce_chunk); });
+#else
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+      reduce_chunk(chunk);
+#endif
+
+    // Second phase, with all the columns.
+    {
+      A_ds_type working, buffer;
+      for (int dim = 0; dim < dim_max_; ++dim)
+        reduce_columns(dim, 0, num_simplices_, working, buffer);
+    }
+
+    for (std::size_t i = 0; i < num_simplices_; ++i) {
+      if (pivot_column[i] != null_key) {
+        Simplex_handle birth = cpx_->simplex(pivot_column[i]);
+        Simplex_handle death = cpx_->simplex(static_cast<Simplex_key>(i));
+        if (interval_length_policy(birth, death))
+          persistent_pairs_.emplace_back(birth, death, coeff_field_.characteristic());
+      } else if (dimensions[i] < dim_max_ && column_status[i] == zero_column) {
+        // Infinite interval
+        persistent_pairs_.emplace_back(cpx_->simplex(static_cast<Simplex_key>(i)), cpx_->null_simplex(),
+                                       coeff_field_.characteristic());
+      }
     }
   }
 
  private:
+  /* Coboundary matrix of the complex, indexed by the keys of the simplices in the order of the filtration. The
+   * coboundary of the simplex of key k is stored in coboundaries, between coboundary_bounds[k] and
+   * coboundary_bounds[k + 1]. youngest_facet[k] is the biggest key in the boundary of k, or null_key() for a vertex.*/
+  void build_coboundary_matrix(std::vector<int>& dimensions, std::vector<Simplex_key>& youngest_facet,
+                               std::vector<std::size_t>& coboundary_bounds,
+                               std::vector<std::pair<Simplex_key, Arith_element>>& coboundaries) {
+    const Simplex_key null_key = cpx_->null_key();
+
+    // Keys may have been modified by compute_persistent_cohomology.
+    Simplex_key idx_fil = 0;
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      cpx_->assign_key(sh, idx_fil);
+      ++idx_fil;
+    }
+
+    // The dimension, the youngest facet and the number of cofacets of each simplex.
+    dimensions.assign(num_simplices_, 0);
+    youngest_facet.assign(num_simplices_, null_key);
+    coboundary_bounds.assign(num_simplices_ + 1, 0);
+    idx_fil = 0;
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      dimensions[idx_fil] = cpx_->dimension(sh);
+      if (dimensions[idx_fil] > 0) {
+        for (auto b_sh : cpx_->boundary_simplex_range(sh)) {
+          Simplex_key key = cpx_->key(b_sh);
+          ++coboundary_bounds[key + 1];
+          if (youngest_facet[idx_fil] == null_key || youngest_facet[idx_fil] < key)
+            youngest_facet[idx_fil] = key;
+        }
+      }
+      ++idx_fil;
+    }
+    for (std::size_t i = 0; i < num_simplices_; ++i)
+      coboundary_bounds[i + 1] += coboundary_bounds[i];
+
+    // Cofacets are inserted in the order of the filtration, so every coboundary is sorted by increasing key.
+    // The coefficient is the one of the facet in the boundary of the cofacet: 1 - 2 * (position of the facet % 2).
+    coboundaries.resize(coboundary_bounds[num_simplices_]);
+    {
+      std::vector<std::size_t> fill(coboundary_bounds.begin(), coboundary_bounds.end() - 1);
+      idx_fil = 0;
+      for (auto sh : cpx_->filtration_simplex_range()) {
+        if (dimensions[idx_fil] > 0) {
+          Arith_element sign = coeff_field_.multiplicative_identity();
+          for (auto b_sh : cpx_->boundary_simplex_range(sh)) {
+            coboundaries[fill[cpx_->key(b_sh)]++] = std::make_pair(idx_fil, sign);
+            sign = coeff_field_.times_minus(sign, coeff_field_.multiplicative_identity());
+          }
+        }
+        ++idx_fil;
+      }
+    }
+  }
+
+  /* Assign:    target <- column + w * [other_begin, other_end), with sparse columns sorted by key. */
+  template<typename Iterator>
+  void plus_equal_column(A_ds_type& target, A_ds_type const& column, Iterator other_begin, Iterator other_end,
+                         Arith_element w) {
+    target.clear();
+    auto column_it = column.begin();
+    while (column_it != column.end() || other_begin != other_end) {
+      if (other_begin == other_end || (column_it != column.end() && column_it->first < other_begin->first)) {
+        target.push_back(*column_it);
+        ++column_it;
+      } else {
+        Arith_element x = coeff_field_.additive_identity();
+        Simplex_key key = other_begin->first;
+        if (column_it != column.end() && column_it->first == key) {
+          x = column_it->second;
+          ++column_it;
+        }
+        x = coeff_field_.plus_times_equal(x, other_begin->second, w);
+        if (x != coeff_field_.additive_identity())
+          target.emplace_back(key, x);
+        ++other_begin;
+      }
+    }
+  }
+
+  // Entries of a working column, the top is the entry with the smallest key.
+  typedef std::pair<Simplex_key, Arith_element> Column_entry;
+  struct Greater_key {
+    bool operator()(const Column_entry& a, const Column_entry& b) const { return a.first > b.first; }
+  };
+  typedef std::priority_queue<Column_entry, std::vector<Column_entry>, Greater_key> Working_column;
+
+  /* Pops the entry with the smallest key of a working column, summing up the coefficients of the entries with the
+   * same key. Returns an entry with null_key() if the column is zero. */
+  Column_entry pop_pivot(Working_column& column) {
+    while (!column.empty()) {
+      Column_entry pivot = column.top();
+      column.pop();
+      while (!column.empty() && column.top().first == pivot.first) {
+        pivot.second = coeff_field_.plus_equal(pivot.second, column.top().second);
+        column.pop();
+      }
+      if (pivot.second != coeff_field_.additive_identity())
+        return pivot;
+    }
+    return Column_entry(cpx_->null_key(), coeff_field_.additive_identity());
+  }
+
+  /* Reduction of the coboundary of the simplex with the given key, with the previously reduced columns. */
+  void reduce_coboundary_column(Simplex_key column,
+                                const std::vector<std::pair<Simplex_key, Arith_element>>& coboundaries,
+                                const std::vector<std::size_t>& coboundary_bounds,
+                                const std::vector<Simplex_key>& youngest_facet,
+                                std::vector<Simplex_key>& pivot_column,
+                                std::vector<Arith_element>& pivot_coefficient,
+                                std::map<Simplex_key, A_ds_type>& reductions) {
+    const Simplex_key null_key = cpx_->null_key();
+    std::size_t cob_begin = coboundary_bounds[column];
+    std::size_t cob_end = coboundary_bounds[column + 1];
+    // Apparent pair: the oldest cofacet has this simplex as youngest facet.
+    if (cob_begin != cob_end && youngest_facet[coboundaries[cob_begin].first] == column) {
+      Simplex_key death_key = coboundaries[cob_begin].first;
+      pivot_column[death_key] = column;
+      pivot_coefficient[death_key] = coboundaries[cob_begin].second;
+      if (interval_length_policy(cpx_->simplex(column), cpx_->simplex(death_key))) {
+        persistent_pairs_.emplace_back(cpx_->simplex(column), cpx_->simplex(death_key),
+                                       coeff_field_.characteristic());
+      }
+      return;
+    }
+
+    Working_column working_coboundary;
+    Working_column working_reduction;
+    working_reduction.emplace(column, coeff_field_.multiplicative_identity());
+    for (std::size_t i = cob_begin; i < cob_end; ++i)
+      working_coboundary.push(coboundaries[i]);
+
+    while (true) {
+      Column_entry pivot = pop_pivot(working_coboundary);
+      if (pivot.first == null_key) {
+        // Infinite interval
+        persistent_pairs_.emplace_back(cpx_->simplex(column), cpx_->null_simplex(), coeff_field_.characteristic());
+        return;
+      }
+      Simplex_key other_column = pivot_column[pivot.first];
+      if (other_column == null_key) {
+        pivot_column[pivot.first] = column;
+        pivot_coefficient[pivot.first] = pivot.second;
+        if (interval_length_policy(cpx_->simplex(column), cpx_->simplex(pivot.first))) {
+          persistent_pairs_.emplace_back(cpx_->simplex(column), cpx_->simplex(pivot.first),
+                                         coeff_field_.characteristic());
+        }
+        // Keep the cocycle representative when it is not reduced to the simplex itself.
+        A_ds_type reduction;
+        for (Column_entry e = pop_pivot(working_reduction); e.first != null_key; e = pop_pivot(working_reduction))
+          reduction.push_back(e);
+        if (reduction.size() > 1 || reduction.front().second != coeff_field_.multiplicative_identity())
+          reductions.emplace(column, std::move(reduction));
+        return;
+      }
+      working_coboundary.push(pivot);
+      // working <- working + w * other, to zero-out the pivot.
+      Arith_element w = coeff_field_.times_minus(
+          pivot.second, coeff_field_.inverse(pivot_coefficient[pivot.first], coeff_field_.characteristic()).first);
+      auto add_simplex = [&](Simplex_key key, Arith_element x) {
+        working_reduction.emplace(key, x);
+        for (std::size_t i = coboundary_bounds[key]; i < coboundary_bounds[key + 1]; ++i)
+          working_coboundary.emplace(coboundaries[i].first, coeff_field_.times(coboundaries[i].second, x));
+      };
+      auto reduction_it = reductions.find(other_column);
+      if (reduction_it == reductions.end()) {
+        add_simplex(other_column, w);
+      } else {
+        for (auto& entry : reduction_it->second)
+          add_simplex(entry.first, coeff_field_.times(entry.second, w));
+      }
+    }
+  }
+
   /** \brief Update the cohomology groups under the insertion of an edge.
    *
    * The 0-homology is maintained with a simple Union-Find data structure, which
@@ -287,7 +637,7 @@ class Persistent_cohomology {
     // traverses the boundary of sigma, keeps track of the annotation vectors,
     // with multiplicity. We used to sum the coefficients directly in
     // annotations_in_boundary by using a map, we now do it later.
-    typedef std::pair<Column *, int> annotation_t;
+    typedef std::pair<Column_handle, int> annotation_t;
 #ifdef GUDHI_CAN_USE_CXX11_THREAD_LOCAL
     thread_local
 #endif  // GUDHI_CAN_USE_CXX11_THREAD_LOCAL
@@ -296,14 +646,15 @@ class Persistent_cohomology {
     int sign = 1 - 2 * (dim_sigma % 2);  // \in {-1,1} provides the sign in the
                                          // alternate sum in the boundary.
     Simplex_key key;
-    Column * curr_col;
+    Column_handle curr_col;
 
     for (auto sh : cpx_->boundary_simplex_range(sigma)) {
       key = cpx_->key(sh);
       if (key != cpx_->null_key()) {  // A simplex with null_key is a killer, and have null annotation
         // Find its annotation vector
         curr_col = ds_repr_[dsets_.find_set(key)];
-        if (curr_col != NULL) {  // and insert it in annotations_in_boundary with multyiplicative factor "sign".
+        // and insert it in annotations_in_boundary with multyiplicative factor "sign".
+        if (curr_col != Cam::null_column()) {
           annotations_in_boundary.emplace_back(curr_col, sign);
         }
       }
@@ -318,26 +669,27 @@ class Persistent_cohomology {
     std::pair<typename std::map<Simplex_key, Arith_element>::iterator, bool> result_insert_a_ds;
 
     for (auto ann_it = annotations_in_boundary.begin(); ann_it != annotations_in_boundary.end(); /**/) {
-      Column* col = ann_it->first;
+      Column_handle col = ann_it->first;
       int mult = ann_it->second;
       while (++ann_it != annotations_in_boundary.end() && ann_it->first == col) {
         mult += ann_it->second;
       }
       // The following test is just a heuristic, it is not required, and it is fine that is misses p == 0.
       if (mult != coeff_field_.additive_identity()) {  // For all columns in the boundary,
-        for (auto cell_ref : col->col_) {  // insert every cell in map_a_ds with multiplicity
-          Arith_element w_y = coeff_field_.times(cell_ref.coefficient_, mult);  // coefficient * multiplicity
+        // insert every cell in map_a_ds with multiplicity
+        cam_.for_each_cell(col, [&](Simplex_key cell_key, const Arith_element& cell_coefficient) {
+          Arith_element w_y = coeff_field_.times(cell_coefficient, mult);  // coefficient * multiplicity
 
           if (w_y != coeff_field_.additive_identity()) {  // if != 0
-            result_insert_a_ds = map_a_ds.insert(std::pair<Simplex_key, Arith_element>(cell_ref.key_, w_y));
-            if (!(result_insert_a_ds.second)) {  // if cell_ref.key_ already a Key in map_a_ds
+            result_insert_a_ds = map_a_ds.insert(std::pair<Simplex_key, Arith_element>(cell_key, w_y));
+            if (!(result_insert_a_ds.second)) {  // if cell_key already a Key in map_a_ds
               result_insert_a_ds.first->second = coeff_field_.plus_equal(result_insert_a_ds.first->second, w_y);
               if (result_insert_a_ds.first->second == coeff_field_.additive_identity()) {
                 map_a_ds.erase(result_insert_a_ds.first);
               }
             }
           }
-        }
+        });
       }
     }
   }
@@ -393,19 +745,9 @@ class Persistent_cohomology {
   void create_cocycle(Simplex_handle sigma, Arith_element x,
                       Arith_element charac) {
     Simplex_key key = cpx_->key(sigma);
-    // Create a column containing only one cell,
-    Column * new_col = column_pool_.construct(key);
-    Cell * new_cell = cell_pool_.construct(key, x, new_col);
-    new_col->col_.push_back(*new_cell);
-    // and insert it in the matrix, in constant time thanks to the hint cam_.end().
-    // Indeed *new_col has the biggest lexicographic value because key is the
-    // biggest key used so far.
-    cam_.insert(cam_.end(), *new_col);
+    // Create a column containing only one cell, and insert it in the matrix.
     // Update the disjoint sets data structure.
-    Hcell * new_hcell = new Hcell;
-    new_hcell->push_back(*new_cell);
-    transverse_idx_[key] = cocycle(charac, new_hcell);  // insert the new row
-    ds_repr_[key] = new_col;
+    ds_repr_[key] = cam_.create_cocycle(key, x, charac);
   }
 
   /*  \brief Destroy a cocycle class.
@@ -426,114 +768,23 @@ class Persistent_cohomology {
           , charac);                                           // fields
     }
 
-    auto death_key_row = transverse_idx_.find(death_key);  // Find the beginning of the row.
-    std::pair<typename Cam::iterator, bool> result_insert_cam;
-
-    auto row_cell_it = death_key_row->second.row_->begin();
-
-    while (row_cell_it != death_key_row->second.row_->end()) {  // Traverse all cells in
-      // the row at index death_key.
-      Arith_element w = coeff_field_.times_minus(inv_x, row_cell_it->coefficient_);
-
-      if (w != coeff_field_.additive_identity()) {
-        Column * curr_col = row_cell_it->self_col_;
-        ++row_cell_it;
-        // Disconnect the column from the rows in the CAM.
-        for (auto& col_cell : curr_col->col_) {
-          col_cell.base_hook_cam_h::unlink();
-        }
-
-        // Remove the column from the CAM before modifying its value
-        cam_.erase(cam_.iterator_to(*curr_col));
-        // Proceed to the reduction of the column
-        plus_equal_column(*curr_col, a_ds, w);
-
-        if (curr_col->col_.empty()) {  // If the column is null
-          ds_repr_[curr_col->class_key_] = NULL;
-          column_pool_.destroy(curr_col);  // delete curr_col;
-        } else {
-          // Find whether the column obtained is already in the CAM
-          result_insert_cam = cam_.insert(*curr_col);
-          if (result_insert_cam.second) {  // If it was not in the CAM before: insertion has succeeded
-            for (auto& col_cell : curr_col->col_) {
-              // re-establish the row links
-              transverse_idx_[col_cell.key_].row_->push_front(col_cell);
-            }
-          } else {  // There is already an identical column in the CAM:
-            // merge two disjoint sets.
-            dsets_.link(curr_col->class_key_,
-                        result_insert_cam.first->class_key_);
-
-            Simplex_key key_tmp = dsets_.find_set(curr_col->class_key_);
-            ds_repr_[key_tmp] = &(*(result_insert_cam.first));
-            result_insert_cam.first->class_key_ = key_tmp;
-            // intrusive containers don't own their elements, we have to release them manually
-            curr_col->col_.clear_and_dispose([&](Cell*p){cell_pool_.destroy(p);});
-            column_pool_.destroy(curr_col);  // delete curr_col;
-          }
-        }
-      } else {
-        ++row_cell_it;
-      }  // If w == 0, pass.
-    }
+    cam_.destroy_cocycle(a_ds, death_key, inv_x, charac,
+                         [this](Simplex_key class_key) {  // If the column is null
+                           ds_repr_[class_key] = Cam::null_column();
+                         },
+                         [this](Simplex_key class_key, Simplex_key other_class_key,
+                                Column_handle other_col) -> Simplex_key {
+                           // There is already an identical column in the CAM: merge two disjoint sets.
+                           dsets_.link(class_key, other_class_key);
+                           Simplex_key key_tmp = dsets_.find_set(class_key);
+                           ds_repr_[key_tmp] = other_col;
+                           return key_tmp;
+                         });
 
     // Because it is a killer simplex, set the data of sigma to null_key().
     if (charac == coeff_field_.characteristic()) {
       cpx_->assign_key(sigma, cpx_->null_key());
     }
-    if (death_key_row->second.characteristics_ == charac) {
-      delete death_key_row->second.row_;
-      transverse_idx_.erase(death_key_row);
-    } else {
-      death_key_row->second.characteristics_ /= charac;
-    }
-  }
-
-  /*
-   * Assign:    target <- target + w * other.
-   */
-  void plus_equal_column(Column & target, A_ds_type const& other  // value_type is pair<Simplex_key,Arith_element>
-                         , Arith_element w) {
-    auto target_it = target.col_.begin();
-    auto other_it = other.begin();
-    while (target_it != target.col_.end() && other_it != other.end()) {
-      if (target_it->key_ < other_it->first) {
-        ++target_it;
-      } else {
-        if (target_it->key_ > other_it->first) {
-          Cell * cell_tmp = cell_pool_.construct(Cell(other_it->first   // key
-              , coeff_field_.additive_identity(), &target));
-
-          cell_tmp->coefficient_ = coeff_field_.plus_times_equal(cell_tmp->coefficient_, other_it->second, w);
-
-          target.col_.insert(target_it, *cell_tmp);
-
-          ++other_it;
-        } else {  // it1->key == it2->key
-          // target_it->coefficient_ <- target_it->coefficient_ + other_it->second * w
-          target_it->coefficient_ = coeff_field_.plus_times_equal(target_it->coefficient_, other_it->second, w);
-          if (target_it->coefficient_ == coeff_field_.additive_identity()) {
-            auto tmp_it = target_it;
-            ++target_it;
-            ++other_it;   // iterators remain valid
-            Cell * tmp_cell_ptr = &(*tmp_it);
-            target.col_.erase(tmp_it);  // removed from column
-
-            cell_pool_.destroy(tmp_cell_ptr);  // delete from memory
-          } else {
-            ++target_it;
-            ++other_it;
-          }
-        }
-      }
-    }
-    while (other_it != other.end()) {
-      Cell * cell_tmp = cell_pool_.construct(Cell(other_it->first, coeff_field_.additive_identity(), &target));
-      cell_tmp->coefficient_ = coeff_field_.plus_times_equal(cell_tmp->coefficient_, other_it->second, w);
-      target.col_.insert(target.col_.end(), *cell_tmp);
-
-      ++other_it;
-    }
   }
 
   /*
@@ -701,24 +952,6 @@ class Persistent_cohomology {
     return result;
   }
 
- private:
-  /*
-   * Structure representing a cocycle.
-   */
-  struct cocycle {
-    cocycle()
-        : row_(nullptr),
-          characteristics_() {
-    }
-    cocycle(Arith_element characteristics, Hcell * row)
-        : row_(row),
-          characteristics_(characteristics) {
-    }
-
-    Hcell * row_;                    // points to the corresponding row in the CAM
-    Arith_element characteristics_;  // product of field characteristics for which the cocycle exist
-  };
-
  public:
   FilteredComplex * cpx_;
   int dim_max_;
@@ -731,7 +964,7 @@ class Persistent_cohomology {
    * Simplex_key -> simplex_key_t */
   std::vector<int> ds_rank_;
   std::vector<Simplex_key> ds_parent_;
-  std::vector<Column *> ds_repr_;
+  std::vector<Column_handle> ds_repr_;
   boost::disjoint_sets<int *, Simplex_key *> dsets_;
   /* The compressed annotation matrix fields.*/
   Cam cam_;
@@ -739,14 +972,9 @@ class Persistent_cohomology {
    * the root vertex in the union-find ds and the Simplex_key of the vertex which
    * created the connected component as a 0-dimension homology feature.*/
   std::map<Simplex_key, Simplex_key> zero_cocycles_;
-  /*  Key -> row. */
-  std::map<Simplex_key, cocycle> transverse_idx_;
   /* Persistent intervals. */
   std::vector<Persistent_interval> persistent_pairs_;
   length_interval interval_length_policy;
-
-  Simple_object_pool<Column> column_pool_;
-  Simple_object_pool<Cell> cell_pool_;
 };
 
 }  // namespace persistent_cohomology
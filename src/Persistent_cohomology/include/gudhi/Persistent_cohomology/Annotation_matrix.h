@@ -0,0 +1,481 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2014 Inria
+ *
+ *    Modification(s):
+ *      - 2026/10 agent: Compressed annotation matrix moved from Persistent_cohomology.h
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_ANNOTATION_MATRIX_H_
+#define PERSISTENT_COHOMOLOGY_ANNOTATION_MATRIX_H_
+
+#include <gudhi/Persistent_cohomology/Persistent_cohomology_column.h>
+#include <gudhi/Simple_object_pool.h>
+
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/list.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/* \brief Compressed annotation matrix with columns stored as boost::intrusive::list of cells.
+ *
+ * Every cell is linked both in its column and in its row, and allocated in a Simple_object_pool. The columns are
+ * stored in a boost::intrusive::set, to detect identical columns.
+ */
+template<typename SimplexKey, typename ArithmeticElement, typename CoefficientField>
+class Intrusive_annotation_matrix {
+ public:
+  typedef Persistent_cohomology_column<SimplexKey, ArithmeticElement> Column;  // contains 1 set_hook
+  typedef Column * Column_handle;
+  // Sparse column type for the annotation of the boundary of an element.
+  typedef std::vector<std::pair<SimplexKey, ArithmeticElement> > A_ds_type;
+
+ private:
+  // Cell type
+  typedef typename Column::Cell Cell;   // contains 2 list_hooks
+  // Remark: constant_time_size must be false because base_hook_cam_h has auto_unlink link_mode
+  typedef boost::intrusive::list<Cell,
+      boost::intrusive::constant_time_size<false>,
+      boost::intrusive::base_hook<base_hook_cam_h> > Hcell;
+
+  typedef boost::intrusive::set<Column,
+      boost::intrusive::constant_time_size<false> > Cam;
+
+  /*
+   * Structure representing a cocycle.
+   */
+  struct cocycle {
+    cocycle()
+        : row_(nullptr),
+          characteristics_() {
+    }
+    cocycle(ArithmeticElement characteristics, Hcell * row)
+        : row_(row),
+          characteristics_(characteristics) {
+    }
+
+    Hcell * row_;                        // points to the corresponding row in the CAM
+    ArithmeticElement characteristics_;  // product of field characteristics for which the cocycle exist
+  };
+
+ public:
+  explicit Intrusive_annotation_matrix(CoefficientField * coeff_field)
+      : coeff_field_(coeff_field),
+        cam_(),
+        transverse_idx_(),
+        column_pool_(),
+        cell_pool_() {
+  }
+
+  Intrusive_annotation_matrix(const Intrusive_annotation_matrix&) = delete;
+  Intrusive_annotation_matrix& operator=(const Intrusive_annotation_matrix&) = delete;
+
+  ~Intrusive_annotation_matrix() {
+    // Clean the transversal lists
+    for (auto & transverse_ref : transverse_idx_) {
+      // Destruct all the cells
+      transverse_ref.second.row_->clear_and_dispose([&](Cell*p){p->~Cell();});
+      delete transverse_ref.second.row_;
+    }
+  }
+
+  static Column_handle null_column() {
+    return nullptr;
+  }
+
+  /* \brief Applies f(key, coefficient) to all the non-zero cells of a column, by increasing key. */
+  template<typename Function>
+  void for_each_cell(Column_handle col, Function&& f) const {
+    for (auto& cell_ref : col->col_) {
+      f(cell_ref.key_, cell_ref.coefficient_);
+    }
+  }
+
+  /* \brief Applies f(key, characteristics) to all the cocycles alive. */
+  template<typename Function>
+  void for_each_cocycle(Function&& f) const {
+    for (auto& cocycle_ref : transverse_idx_) {
+      f(cocycle_ref.first, cocycle_ref.second.characteristics_);
+    }
+  }
+
+  /*  \brief Create a new cocycle class, with value x on the simplex of the given key, and returns its column. */
+  Column_handle create_cocycle(SimplexKey key, ArithmeticElement x, ArithmeticElement charac) {
+    // Create a column containing only one cell,
+    Column * new_col = column_pool_.construct(key);
+    Cell * new_cell = cell_pool_.construct(key, x, new_col);
+    new_col->col_.push_back(*new_cell);
+    // and insert it in the matrix, in constant time thanks to the hint cam_.end().
+    // Indeed *new_col has the biggest lexicographic value because key is the
+    // biggest key used so far.
+    cam_.insert(cam_.end(), *new_col);
+    Hcell * new_hcell = new Hcell;
+    new_hcell->push_back(*new_cell);
+    transverse_idx_[key] = cocycle(charac, new_hcell);  // insert the new row
+    return new_col;
+  }
+
+  /*  \brief Destroy a cocycle class.
+   *
+   * Zeros-out the row death_key by adding a multiple of a_ds to all the columns with a non-zero coefficient in
+   * this row. on_null(class_key) is called when a column becomes null, and
+   * on_merge(class_key, other_class_key, other_column) when it becomes identical to another column of the matrix. The
+   * latter returns the new class key of the merged column.*/
+  template<typename Null_function, typename Merge_function>
+  void destroy_cocycle(A_ds_type const& a_ds, SimplexKey death_key, ArithmeticElement inv_x,
+                       ArithmeticElement charac, Null_function&& on_null, Merge_function&& on_merge) {
+    auto death_key_row = transverse_idx_.find(death_key);  // Find the beginning of the row.
+    std::pair<typename Cam::iterator, bool> result_insert_cam;
+
+    auto row_cell_it = death_key_row->second.row_->begin();
+
+    while (row_cell_it != death_key_row->second.row_->end()) {  // Traverse all cells in
+      // the row at index death_key.
+      ArithmeticElement w = coeff_field_->times_minus(inv_x, row_cell_it->coefficient_);
+
+      if (w != coeff_field_->additive_identity()) {
+        Column * curr_col = row_cell_it->self_col_;
+        ++row_cell_it;
+        // Disconnect the column from the rows in the CAM.
+        for (auto& col_cell : curr_col->col_) {
+          col_cell.base_hook_cam_h::unlink();
+        }
+
+        // Remove the column from the CAM before modifying its value
+        cam_.erase(cam_.iterator_to(*curr_col));
+        // Proceed to the reduction of the column
+        plus_equal_column(*curr_col, a_ds, w);
+
+        if (curr_col->col_.empty()) {  // If the column is null
+          on_null(curr_col->class_key_);
+          column_pool_.destroy(curr_col);  // delete curr_col;
+        } else {
+          // Find whether the column obtained is already in the CAM
+          result_insert_cam = cam_.insert(*curr_col);
+          if (result_insert_cam.second) {  // If it was not in the CAM before: insertion has succeeded
+            for (auto& col_cell : curr_col->col_) {
+              // re-establish the row links
+              transverse_idx_[col_cell.key_].row_->push_front(col_cell);
+            }
+          } else {  // There is already an identical column in the CAM:
+            // merge two disjoint sets.
+            result_insert_cam.first->class_key_ = on_merge(curr_col->class_key_,
+                                                           result_insert_cam.first->class_key_,
+                                                           &(*(result_insert_cam.first)));
+            // intrusive containers don't own their elements, we have to release them manually
+            curr_col->col_.clear_and_dispose([&](Cell*p){cell_pool_.destroy(p);});
+            column_pool_.destroy(curr_col);  // delete curr_col;
+          }
+        }
+      } else {
+        ++row_cell_it;
+      }  // If w == 0, pass.
+    }
+
+    if (death_key_row->second.characteristics_ == charac) {
+      delete death_key_row->second.row_;
+      transverse_idx_.erase(death_key_row);
+    } else {
+      death_key_row->second.characteristics_ /= charac;
+    }
+  }
+
+ private:
+  /*
+   * Assign:    target <- target + w * other.
+   */
+  void plus_equal_column(Column & target, A_ds_type const& other  // value_type is pair<SimplexKey,ArithmeticElement>
+                         , ArithmeticElement w) {
+    auto target_it = target.col_.begin();
+    auto other_it = other.begin();
+    while (target_it != target.col_.end() && other_it != other.end()) {
+      if (target_it->key_ < other_it->first) {
+        ++target_it;
+      } else {
+        if (target_it->key_ > other_it->first) {
+          Cell * cell_tmp = cell_pool_.construct(Cell(other_it->first   // key
+              , coeff_field_->additive_identity(), &target));
+
+          cell_tmp->coefficient_ = coeff_field_->plus_times_equal(cell_tmp->coefficient_, other_it->second, w);
+
+          target.col_.insert(target_it, *cell_tmp);
+
+          ++other_it;
+        } else {  // it1->key == it2->key
+          // target_it->coefficient_ <- target_it->coefficient_ + other_it->second * w
+          target_it->coefficient_ = coeff_field_->plus_times_equal(target_it->coefficient_, other_it->second, w);
+          if (target_it->coefficient_ == coeff_field_->additive_identity()) {
+            auto tmp_it = target_it;
+            ++target_it;
+            ++other_it;   // iterators remain valid
+            Cell * tmp_cell_ptr = &(*tmp_it);
+            target.col_.erase(tmp_it);  // removed from column
+
+            cell_pool_.destroy(tmp_cell_ptr);  // delete from memory
+          } else {
+            ++target_it;
+            ++other_it;
+          }
+        }
+      }
+    }
+    while (other_it != other.end()) {
+      Cell * cell_tmp = cell_pool_.construct(Cell(other_it->first, coeff_field_->additive_identity(), &target));
+      cell_tmp->coefficient_ = coeff_field_->plus_times_equal(cell_tmp->coefficient_, other_it->second, w);
+      target.col_.insert(target.col_.end(), *cell_tmp);
+
+      ++other_it;
+    }
+  }
+
+  CoefficientField * coeff_field_;
+  /* The compressed annotation matrix fields.*/
+  Cam cam_;
+  /*  Key -> row. */
+  std::map<SimplexKey, cocycle> transverse_idx_;
+
+  Simple_object_pool<Column> column_pool_;
+  Simple_object_pool<Cell> cell_pool_;
+};
+
+/* \brief Compressed annotation matrix with columns stored as contiguous sorted vectors.
+ *
+ * Columns are referred to by their index in a vector, and identical columns are detected with a hash table. A row
+ * only stores the indices of the columns which had a non-zero coefficient in it at some point: it is cleaned lazily
+ * when it is traversed, by checking the coefficient in the column.
+ */
+template<typename SimplexKey, typename ArithmeticElement, typename CoefficientField>
+class Flat_annotation_matrix {
+ public:
+  typedef std::size_t Column_handle;
+  // Sparse column type for the annotation of the boundary of an element.
+  typedef std::vector<std::pair<SimplexKey, ArithmeticElement> > A_ds_type;
+
+ private:
+  struct Column {
+    A_ds_type cells_;  // sorted by increasing key
+    SimplexKey class_key_;
+    std::size_t hash_;
+  };
+
+  struct Row {
+    ArithmeticElement characteristics_;  // product of field characteristics for which the cocycle exist
+    std::vector<Column_handle> columns_;  // may contain columns that are now zero in this row
+  };
+
+  struct Column_hash {
+    explicit Column_hash(const std::vector<Column> * columns) : columns_(columns) {}
+    std::size_t operator()(Column_handle col) const { return (*columns_)[col].hash_; }
+    const std::vector<Column> * columns_;
+  };
+
+  struct Column_equal {
+    explicit Column_equal(const std::vector<Column> * columns) : columns_(columns) {}
+    bool operator()(Column_handle c1, Column_handle c2) const {
+      return (*columns_)[c1].cells_ == (*columns_)[c2].cells_;
+    }
+    const std::vector<Column> * columns_;
+  };
+
+ public:
+  explicit Flat_annotation_matrix(CoefficientField * coeff_field)
+      : coeff_field_(coeff_field),
+        columns_(),
+        free_columns_(),
+        column_set_(0, Column_hash(&columns_), Column_equal(&columns_)),
+        rows_(),
+        buffer_() {
+  }
+
+  Flat_annotation_matrix(const Flat_annotation_matrix&) = delete;
+  Flat_annotation_matrix& operator=(const Flat_annotation_matrix&) = delete;
+
+  static Column_handle null_column() {
+    return std::numeric_limits<Column_handle>::max();
+  }
+
+  /* \brief Applies f(key, coefficient) to all the non-zero cells of a column, by increasing key. */
+  template<typename Function>
+  void for_each_cell(Column_handle col, Function&& f) const {
+    for (auto& cell_ref : columns_[col].cells_) {
+      f(cell_ref.first, cell_ref.second);
+    }
+  }
+
+  /* \brief Applies f(key, characteristics) to all the cocycles alive. */
+  template<typename Function>
+  void for_each_cocycle(Function&& f) const {
+    for (auto& row_ref : rows_) {
+      f(row_ref.first, row_ref.second.characteristics_);
+    }
+  }
+
+  /*  \brief Create a new cocycle class, with value x on the simplex of the given key, and returns its column. */
+  Column_handle create_cocycle(SimplexKey key, ArithmeticElement x, ArithmeticElement charac) {
+    Column_handle new_col = new_column();
+    Column& col = columns_[new_col];
+    col.cells_.emplace_back(key, x);
+    col.class_key_ = key;
+    col.hash_ = hash_cells(col.cells_);
+    // key is the biggest key used so far, the column cannot be already in the matrix.
+    column_set_.insert(new_col);
+    Row& row = rows_[key];
+    row.characteristics_ = charac;
+    row.columns_.assign(1, new_col);
+    return new_col;
+  }
+
+  /*  \brief Destroy a cocycle class.
+   *
+   * Same as Intrusive_annotation_matrix::destroy_cocycle. */
+  template<typename Null_function, typename Merge_function>
+  void destroy_cocycle(A_ds_type const& a_ds, SimplexKey death_key, ArithmeticElement inv_x,
+                       ArithmeticElement charac, Null_function&& on_null, Merge_function&& on_merge) {
+    auto death_key_row = rows_.find(death_key);
+    // The row is modified by plus_equal_column only for keys different from death_key, it is safe to traverse it.
+    std::vector<Column_handle>& row_columns = death_key_row->second.columns_;
+    std::sort(row_columns.begin(), row_columns.end());
+    row_columns.erase(std::unique(row_columns.begin(), row_columns.end()), row_columns.end());
+
+    for (Column_handle curr_col : row_columns) {
+      A_ds_type& cells = columns_[curr_col].cells_;
+      auto cell_it = std::lower_bound(cells.begin(), cells.end(), death_key,
+                                      [](const std::pair<SimplexKey, ArithmeticElement>& cell, SimplexKey key) {
+                                        return cell.first < key;
+                                      });
+      if (cell_it == cells.end() || cell_it->first != death_key) continue;  // outdated entry of the row
+
+      ArithmeticElement w = coeff_field_->times_minus(inv_x, cell_it->second);
+      if (w == coeff_field_->additive_identity()) continue;
+
+      // Remove the column from the hash table before modifying its value
+      column_set_.erase(curr_col);
+      plus_equal_column(curr_col, a_ds, w);
+
+      Column& col = columns_[curr_col];
+      if (col.cells_.empty()) {  // If the column is null
+        on_null(col.class_key_);
+        free_columns_.push_back(curr_col);
+      } else {
+        auto result_insert = column_set_.insert(curr_col);
+        if (!result_insert.second) {  // There is already an identical column in the matrix
+          Column& other_col = columns_[*result_insert.first];
+          other_col.class_key_ = on_merge(col.class_key_, other_col.class_key_, *result_insert.first);
+          col.cells_.clear();
+          free_columns_.push_back(curr_col);
+        }
+      }
+    }
+
+    if (death_key_row->second.characteristics_ == charac) {
+      rows_.erase(death_key_row);
+    } else {
+      death_key_row->second.characteristics_ /= charac;
+    }
+  }
+
+ private:
+  Column_handle new_column() {
+    if (!free_columns_.empty()) {
+      Column_handle col = free_columns_.back();
+      free_columns_.pop_back();
+      return col;
+    }
+    columns_.emplace_back();
+    return columns_.size() - 1;
+  }
+
+  static std::size_t hash_cells(A_ds_type const& cells) {
+    std::size_t seed = cells.size();
+    for (auto& cell : cells) {
+      seed ^= static_cast<std::size_t>(cell.first) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+
+  /*
+   * Assign:    target <- target + w * other.
+   * Registers the target column in the rows of the keys that appear in it.
+   */
+  void plus_equal_column(Column_handle target_col, A_ds_type const& other, ArithmeticElement w) {
+    A_ds_type& target = columns_[target_col].cells_;
+    buffer_.clear();
+    buffer_.reserve(target.size() + other.size());
+    auto target_it = target.begin();
+    auto other_it = other.begin();
+    while (target_it != target.end() || other_it != other.end()) {
+      if (other_it == other.end() || (target_it != target.end() && target_it->first < other_it->first)) {
+        buffer_.push_back(*target_it);
+        ++target_it;
+      } else if (target_it == target.end() || target_it->first > other_it->first) {
+        ArithmeticElement x = coeff_field_->plus_times_equal(coeff_field_->additive_identity(), other_it->second, w);
+        if (x != coeff_field_->additive_identity()) {
+          buffer_.emplace_back(other_it->first, x);
+          rows_.find(other_it->first)->second.columns_.push_back(target_col);
+        }
+        ++other_it;
+      } else {  // target_it->first == other_it->first
+        ArithmeticElement x = coeff_field_->plus_times_equal(target_it->second, other_it->second, w);
+        if (x != coeff_field_->additive_identity()) {
+          buffer_.emplace_back(target_it->first, x);
+        }
+        ++target_it;
+        ++other_it;
+      }
+    }
+    target.swap(buffer_);
+    columns_[target_col].hash_ = hash_cells(target);
+  }
+
+  CoefficientField * coeff_field_;
+  std::vector<Column> columns_;
+  std::vector<Column_handle> free_columns_;
+  std::unordered_set<Column_handle, Column_hash, Column_equal> column_set_;
+  /*  Key -> row. */
+  std::unordered_map<SimplexKey, Row> rows_;
+  A_ds_type buffer_;
+};
+
+/** \brief Column storage policy of `Persistent_cohomology` where the columns of the compressed annotation matrix
+ * are intrusive linked lists of cells.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * Adding a multiple of a column is done in place, without moving the other cells.
+ */
+struct Intrusive_column_storage {
+  template<typename SimplexKey, typename ArithmeticElement, typename CoefficientField>
+  using Annotation_matrix = Intrusive_annotation_matrix<SimplexKey, ArithmeticElement, CoefficientField>;
+};
+
+/** \brief Column storage policy of `Persistent_cohomology` where the columns of the compressed annotation matrix
+ * are contiguous vectors sorted by key.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * Columns are smaller and traversed without pointer chasing, at the price of a copy of the column when it is
+ * modified.
+ */
+struct Flat_column_storage {
+  template<typename SimplexKey, typename ArithmeticElement, typename CoefficientField>
+  using Annotation_matrix = Flat_annotation_matrix<SimplexKey, ArithmeticElement, CoefficientField>;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_ANNOTATION_MATRIX_H_
@@ -0,0 +1,301 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef PERSISTENT_HOMOLOGY_H_
+#define PERSISTENT_HOMOLOGY_H_
+
+#include <gudhi/Persistent_cohomology/Field_Zp.h>
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <tuple>
+#include <algorithm>
+#include <limits>  // for numeric_limits<>
+#include <iostream>
+#include <stdexcept>  // for std::out_of_range
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Computes the persistent homology of a filtered complex, by reduction of its boundary matrix.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * The boundary matrix is reduced with the twist algorithm \cite Chen11persistenthomology : the columns are reduced
+ * dimension by dimension, from the highest to the lowest one, and the column of a simplex that creates a
+ * homology class killed by a column of higher dimension is set to zero without being reduced.
+ *
+ * It takes the same FilteredComplex as `Persistent_cohomology`, and returns the same persistence intervals, but the
+ * boundaries of all the simplices are stored explicitly. This is usually faster on complexes that are cheap to store,
+ * like `Gudhi::cubical_complex::Bitmap_cubical_complex` or `Gudhi::Hasse_complex`.
+ *
+ * Only coefficient fields with a single characteristic, like `Field_Zp`, are supported.
+ */
+template<class FilteredComplex, class CoefficientField = Field_Zp>
+class Persistent_homology {
+ public:
+  /** \brief Data stored for each simplex. */
+  typedef typename FilteredComplex::Simplex_key Simplex_key;
+  /** \brief Handle to specify a simplex. */
+  typedef typename FilteredComplex::Simplex_handle Simplex_handle;
+  /** \brief Type for the value of the filtration function. */
+  typedef typename FilteredComplex::Filtration_value Filtration_value;
+  /** \brief Type of element of the field. */
+  typedef typename CoefficientField::Element Arith_element;
+  /** \brief Type for birth and death FilteredComplex::Simplex_handle.
+   * The Arith_element field is the characteristic of the coefficient field. */
+  typedef std::tuple<Simplex_handle, Simplex_handle, Arith_element> Persistent_interval;
+
+ private:
+  // Sparse column of the boundary matrix, sorted by increasing key.
+  typedef std::vector<std::pair<Simplex_key, Arith_element> > Column;
+
+ public:
+  /** \brief Initializes the Persistent_homology class.
+   *
+   * @param[in] cpx Complex for which the persistent homology is computed.
+   * cpx is a model of FilteredComplex
+   *
+   * @param[in] persistence_dim_max if true, the persistent homology for the maximal dimension in the
+   *                                complex is computed. If false, it is ignored. Default is false.
+   *
+   * @exception std::out_of_range In case the number of simplices is more than Simplex_key type numeric limit.
+   */
+  explicit Persistent_homology(FilteredComplex& cpx, bool persistence_dim_max = false)
+      : cpx_(&cpx),
+        dim_max_(cpx.dimension()),
+        coeff_field_(),
+        num_simplices_(cpx_->num_simplices()),
+        persistent_pairs_(),
+        min_interval_length_(0) {
+    if (cpx_->num_simplices() > std::numeric_limits<Simplex_key>::max()) {
+      // num_simplices must be strictly lower than the limit, because a value is reserved for null_key.
+      throw std::out_of_range("The number of simplices is more than Simplex_key type numeric limit.");
+    }
+    Simplex_key idx_fil = 0;
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      cpx_->assign_key(sh, idx_fil);
+      ++idx_fil;
+    }
+    if (persistence_dim_max) {
+      ++dim_max_;
+    }
+  }
+
+  /** \brief Initializes the coefficient field.*/
+  void init_coefficients(int charac) {
+    coeff_field_.init(charac);
+  }
+
+  /** \brief Compute the persistent homology of the filtered simplicial
+   * complex.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   *
+   * Assumes that the filtration provided by the simplicial complex is
+   * valid. Undefined behavior otherwise. */
+  void compute_persistent_homology(Filtration_value min_interval_length = 0) {
+    min_interval_length_ = min_interval_length;
+    const Simplex_key null_key = cpx_->null_key();
+
+    // Boundary matrix, only for the simplices that can kill a class of dimension lower than dim_max_.
+    std::vector<int> dimensions(num_simplices_);
+    std::vector<Column> columns(num_simplices_);
+    int max_dim = 0;
+    Simplex_key idx_fil = 0;
+    for (auto sh : cpx_->filtration_simplex_range()) {
+      int dim = cpx_->dimension(sh);
+      dimensions[idx_fil] = dim;
+      if (dim > 0 && dim <= dim_max_) {
+        max_dim = std::max(max_dim, dim);
+        Column& column = columns[idx_fil];
+        Arith_element sign = coeff_field_.multiplicative_identity();
+        for (auto b_sh : cpx_->boundary_simplex_range(sh)) {
+          column.emplace_back(cpx_->key(b_sh), sign);
+          sign = coeff_field_.times_minus(sign, coeff_field_.multiplicative_identity());
+        }
+        std::sort(column.begin(), column.end());
+      }
+      ++idx_fil;
+    }
+
+    // pivot_column[k] is the column whose reduced boundary has k as pivot (highest key), or null_key.
+    std::vector<Simplex_key> pivot_column(num_simplices_, null_key);
+    std::vector<bool> is_pivot(num_simplices_, false);
+    Column buffer;
+    for (int dim = max_dim; dim > 0; --dim) {
+      for (std::size_t j = 0; j < num_simplices_; ++j) {
+        if (dimensions[j] != dim) continue;
+        Column& column = columns[j];
+        if (is_pivot[j]) {  // twist: the column of a creator is reduced to zero.
+          Column().swap(column);
+          continue;
+        }
+        while (!column.empty()) {
+          Simplex_key pivot = column.back().first;
+          Simplex_key other = pivot_column[pivot];
+          if (other == null_key) {
+            pivot_column[pivot] = static_cast<Simplex_key>(j);
+            is_pivot[pivot] = true;
+            break;
+          }
+          // column <- column + w * other, to zero-out the pivot.
+          const Column& other_column = columns[other];
+          Arith_element w = coeff_field_.times_minus(
+              column.back().second,
+              coeff_field_.inverse(other_column.back().second, coeff_field_.characteristic()).first);
+          plus_equal_column(buffer, column, other_column, w);
+          column.swap(buffer);
+        }
+      }
+    }
+
+    for (std::size_t i = 0; i < num_simplices_; ++i) {
+      if (dimensions[i] >= dim_max_) continue;
+      Simplex_handle birth = cpx_->simplex(static_cast<Simplex_key>(i));
+      Simplex_key death_key = pivot_column[i];
+      if (death_key != null_key) {
+        Simplex_handle death = cpx_->simplex(death_key);
+        if (cpx_->filtration(death) - cpx_->filtration(birth) > min_interval_length_)
+          persistent_pairs_.emplace_back(birth, death, coeff_field_.characteristic());
+      } else if (columns[i].empty()) {
+        // Infinite interval
+        persistent_pairs_.emplace_back(birth, cpx_->null_simplex(), coeff_field_.characteristic());
+      }
+    }
+  }
+
+ private:
+  /*
+   * Assign:    target <- column + w * other.
+   */
+  void plus_equal_column(Column& target, const Column& column, const Column& other, Arith_element w) {
+    target.clear();
+    auto column_it = column.begin();
+    auto other_it = other.begin();
+    while (column_it != column.end() || other_it != other.end()) {
+      if (other_it == other.end() || (column_it != column.end() && column_it->first < other_it->first)) {
+        target.push_back(*column_it);
+        ++column_it;
+      } else {
+        Arith_element x = coeff_field_.additive_identity();
+        Simplex_key key = other_it->first;
+        if (column_it != column.end() && column_it->first == key) {
+          x = column_it->second;
+          ++column_it;
+        }
+        x = coeff_field_.plus_times_equal(x, other_it->second, w);
+        if (x != coeff_field_.additive_identity())
+          target.emplace_back(key, x);
+        ++other_it;
+      }
+    }
+  }
+
+  /*
+   * Compare two intervals by length.
+   */
+  struct cmp_intervals_by_length {
+    explicit cmp_intervals_by_length(FilteredComplex * sc)
+        : sc_(sc) {
+    }
+    bool operator()(const Persistent_interval & p1, const Persistent_interval & p2) {
+      return (sc_->filtration(std::get<1>(p1)) - sc_->filtration(std::get<0>(p1))
+          > sc_->filtration(std::get<1>(p2)) - sc_->filtration(std::get<0>(p2)));
+    }
+    FilteredComplex * sc_;
+  };
+
+ public:
+  /** \brief Output the persistence diagram in ostream, in the same format as
+   * `Persistent_cohomology::output_diagram`.
+   */
+  void output_diagram(std::ostream& ostream = std::cout) {
+    cmp_intervals_by_length cmp(cpx_);
+    std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_), cmp);
+    bool has_infinity = std::numeric_limits<Filtration_value>::has_infinity;
+    for (auto pair : persistent_pairs_) {
+      // Special case on windows, inf is "1.#INF" (cf. unitary tests and R package TDA)
+      if (has_infinity && cpx_->filtration(std::get<1>(pair)) == std::numeric_limits<Filtration_value>::infinity()) {
+        ostream << std::get<2>(pair) << "  " << cpx_->dimension(std::get<0>(pair)) << " "
+          << cpx_->filtration(std::get<0>(pair)) << " inf " << std::endl;
+      } else {
+        ostream << std::get<2>(pair) << "  " << cpx_->dimension(std::get<0>(pair)) << " "
+          << cpx_->filtration(std::get<0>(pair)) << " "
+          << cpx_->filtration(std::get<1>(pair)) << " " << std::endl;
+      }
+    }
+  }
+
+  /** @brief Returns Betti numbers.
+   * @return A vector of Betti numbers.
+   */
+  std::vector<int> betti_numbers() const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto pair : persistent_pairs_) {
+      if (cpx_->null_simplex() == std::get<1>(pair)) {
+        betti_numbers[cpx_->dimension(std::get<0>(pair))] += 1;
+      }
+    }
+    return betti_numbers;
+  }
+
+  /** @brief Returns the persistent Betti numbers.
+   * @param[in] from The persistence birth limit to be added in the number \f$(persistent birth \leq from)\f$.
+   * @param[in] to The persistence death limit to be added in the number  \f$(persistent death > to)\f$.
+   * @return A vector of persistent Betti numbers.
+   */
+  std::vector<int> persistent_betti_numbers(Filtration_value from, Filtration_value to) const {
+    std::vector<int> betti_numbers(dim_max_, 0);
+    for (auto pair : persistent_pairs_) {
+      if (cpx_->filtration(std::get<0>(pair)) <= from &&
+          (std::get<1>(pair) == cpx_->null_simplex() || cpx_->filtration(std::get<1>(pair)) > to)) {
+        betti_numbers[cpx_->dimension(std::get<0>(pair))] += 1;
+      }
+    }
+    return betti_numbers;
+  }
+
+  /** @brief Returns a list of persistence birth and death FilteredComplex::Simplex_handle pairs.
+   * @return A list of Persistent_homology::Persistent_interval
+   */
+  const std::vector<Persistent_interval>& get_persistent_pairs() const {
+    return persistent_pairs_;
+  }
+
+  /** @brief Returns persistence intervals for a given dimension.
+   * @param[in] dimension Dimension to get the birth and death pairs from.
+   * @return A vector of persistence intervals (birth and death) on a fixed dimension.
+   */
+  std::vector< std::pair< Filtration_value , Filtration_value > >
+  intervals_in_dimension(int dimension) {
+    std::vector< std::pair< Filtration_value , Filtration_value > > result;
+    for (auto && pair : persistent_pairs_) {
+      if (cpx_->dimension(std::get<0>(pair)) == dimension) {
+        result.emplace_back(cpx_->filtration(std::get<0>(pair)), cpx_->filtration(std::get<1>(pair)));
+      }
+    }
+    return result;
+  }
+
+ private:
+  FilteredComplex * cpx_;
+  int dim_max_;
+  CoefficientField coeff_field_;
+  std::size_t num_simplices_;
+  /* Persistent intervals. */
+  std::vector<Persistent_interval> persistent_pairs_;
+  Filtration_value min_interval_length_;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_HOMOLOGY_H_
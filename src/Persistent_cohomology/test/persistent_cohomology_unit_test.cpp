@@ -5,6 +5,8 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <cstdint>  // for std::uint8_t
+#include <tuple>
+#include <vector>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "persistent_cohomology"
@@ -14,6 +16,7 @@
 #include <gudhi/reader_utils.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistent_homology.h>
 
 using namespace Gudhi;
 using namespace Gudhi::persistent_cohomology;
@@ -166,11 +169,217 @@ BOOST_AUTO_TEST_CASE( rips_persistent_cohomology_single_field_dim_5 )
   test_rips_persistence_in_dimension(5);
 }
 
+using Diagram = std::vector<std::tuple<int, typeST::Filtration_value, typeST::Filtration_value>>;
+
+template<class Persistence>
+Diagram sorted_diagram(typeST& st, Persistence& pcoh) {
+  Diagram diagram;
+  for (auto pair : pcoh.get_persistent_pairs()) {
+    auto death = std::get<1>(pair) == st.null_simplex() ? std::numeric_limits<typeST::Filtration_value>::infinity()
+                                                         : st.filtration(std::get<1>(pair));
+    diagram.emplace_back(st.dimension(std::get<0>(pair)), st.filtration(std::get<0>(pair)), death);
+  }
+  std::sort(diagram.begin(), diagram.end());
+  return diagram;
+}
+
+using Persistence = Persistent_cohomology<typeST, Field_Zp>;
+
+// Compares the diagram of compute_persistent_cohomology with the one of another computation method.
+template<typename Compute>
+void test_same_diagram(typeST& st, int coefficient, double min_persistence, bool persistence_dim_max,
+                       Compute compute) {
+  Persistence pcoh(st, persistence_dim_max);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology(min_persistence);
+  Diagram cam_diagram = sorted_diagram(st, pcoh);
+
+  Persistence pcoh_other(st, persistence_dim_max);
+  pcoh_other.init_coefficients(coefficient);
+  compute(pcoh_other, min_persistence);
+  Diagram other_diagram = sorted_diagram(st, pcoh_other);
+
+  std::cout << "coefficient=" << coefficient << " - min_persistence=" << min_persistence << " - number of intervals="
+      << cam_diagram.size() << std::endl;
+  BOOST_CHECK(cam_diagram == other_diagram);
+}
+
+void test_persistence_with_clearing(typeST& st, int coefficient, double min_persistence, bool persistence_dim_max) {
+  test_same_diagram(st, coefficient, min_persistence, persistence_dim_max, [](Persistence& pcoh, double min_pers) {
+    pcoh.compute_persistent_cohomology_with_clearing(min_pers);
+  });
+}
+
+void test_persistence_parallel(typeST& st, int coefficient, double min_persistence, bool persistence_dim_max) {
+  for (int num_threads : {1, 2, 4}) {
+    test_same_diagram(st, coefficient, min_persistence, persistence_dim_max,
+                      [num_threads](Persistence& pcoh, double min_pers) {
+                        pcoh.compute_persistent_cohomology_parallel(num_threads, min_pers);
+                      });
+  }
+}
+
+// Flag complex of points on a grid of the flat torus, with many equal filtration values
+void flag_complex_on_torus_grid(typeST& flag_st) {
+  const int grid = 6;
+  for (int i = 0; i < grid * grid; ++i)
+    flag_st.insert_simplex({i}, 0.);
+  for (int i = 0; i < grid * grid; ++i) {
+    for (int j = i + 1; j < grid * grid; ++j) {
+      int dx = std::abs(i / grid - j / grid);
+      int dy = std::abs(i % grid - j % grid);
+      dx = std::min(dx, grid - dx);
+      dy = std::min(dy, grid - dy);
+      double distance = std::sqrt(dx * dx + dy * dy + 0.01 * ((i * 7 + j * 13) % 5));
+      if (distance < 2.)
+        flag_st.insert_simplex({i, j}, distance);
+    }
+  }
+  flag_st.expansion(3);
+  flag_st.initialize_filtration();
+  std::cout << "The flag complex contains " << flag_st.num_simplices() << " simplices" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE( persistent_cohomology_with_clearing )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (int coefficient : {2, 3, 11}) {
+    test_persistence_with_clearing(st, coefficient, 0., false);
+    test_persistence_with_clearing(st, coefficient, 0.5, false);
+    test_persistence_with_clearing(st, coefficient, 0., true);
+  }
+
+  typeST flag_st;
+  flag_complex_on_torus_grid(flag_st);
+
+  for (int coefficient : {2, 3}) {
+    test_persistence_with_clearing(flag_st, coefficient, 0., false);
+    test_persistence_with_clearing(flag_st, coefficient, 0., true);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( persistent_cohomology_parallel )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (int coefficient : {2, 3, 11}) {
+    test_persistence_parallel(st, coefficient, 0., false);
+    test_persistence_parallel(st, coefficient, 0.5, false);
+    test_persistence_parallel(st, coefficient, 0., true);
+  }
+
+  typeST flag_st;
+  flag_complex_on_torus_grid(flag_st);
+
+  for (int coefficient : {2, 3}) {
+    test_persistence_parallel(flag_st, coefficient, 0., false);
+    test_persistence_parallel(flag_st, coefficient, 0., true);
+  }
+}
+
 // TODO(VR): not working from 6
 // std::string str_rips_persistence = test_rips_persistence(6, 0);
 // TODO(VR): division by zero
 // std::string str_rips_persistence = test_rips_persistence(0, 0);
 
+void test_flat_column_storage(typeST& st, int coefficient, bool persistence_dim_max) {
+  Persistent_cohomology<typeST, Field_Zp> pcoh(st, persistence_dim_max);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology();
+  Diagram intrusive_diagram = sorted_diagram(st, pcoh);
+
+  Persistent_cohomology<typeST, Field_Zp, Flat_column_storage> pcoh_flat(st, persistence_dim_max);
+  pcoh_flat.init_coefficients(coefficient);
+  pcoh_flat.compute_persistent_cohomology();
+  Diagram flat_diagram = sorted_diagram(st, pcoh_flat);
+
+  std::cout << "coefficient=" << coefficient << " - number of intervals=" << intrusive_diagram.size() << std::endl;
+  BOOST_CHECK(intrusive_diagram == flat_diagram);
+}
+
+BOOST_AUTO_TEST_CASE( persistent_cohomology_flat_column_storage )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (int coefficient : {2, 3, 11}) {
+    test_flat_column_storage(st, coefficient, false);
+    test_flat_column_storage(st, coefficient, true);
+  }
+
+  // Full 2-skeleton of the simplex on 12 vertices, with many identical annotation vectors.
+  typeST full_st;
+  std::vector<int> vertices(12);
+  for (int i = 0; i < 12; ++i) vertices[i] = i;
+  full_st.insert_simplex_and_subfaces(vertices, 0.);
+  for (auto sh : full_st.complex_simplex_range()) {
+    int sum = 0;
+    for (auto v : full_st.simplex_vertex_range(sh)) sum += (v * 7) % 13;
+    full_st.assign_filtration(sh, full_st.dimension(sh) + (sum % 11) / 11.);
+  }
+  full_st.make_filtration_non_decreasing();
+  full_st.prune_above_filtration(2.99);
+  full_st.initialize_filtration();
+  std::cout << "The complex contains " << full_st.num_simplices() << " simplices" << std::endl;
+
+  for (int coefficient : {2, 5}) {
+    test_flat_column_storage(full_st, coefficient, false);
+  }
+}
+
+void test_persistent_homology(typeST& st, int coefficient, double min_persistence, bool persistence_dim_max) {
+  Persistence pcoh(st, persistence_dim_max);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology(min_persistence);
+  Diagram cohomology_diagram = sorted_diagram(st, pcoh);
+  std::vector<int> cohomology_betti_numbers = pcoh.betti_numbers();
+
+  Persistent_homology<typeST, Field_Zp> phom(st, persistence_dim_max);
+  phom.init_coefficients(coefficient);
+  phom.compute_persistent_homology(min_persistence);
+  Diagram homology_diagram = sorted_diagram(st, phom);
+
+  std::cout << "coefficient=" << coefficient << " - min_persistence=" << min_persistence << " - number of intervals="
+      << cohomology_diagram.size() << std::endl;
+  BOOST_CHECK(cohomology_diagram == homology_diagram);
+  BOOST_CHECK(cohomology_betti_numbers == phom.betti_numbers());
+}
+
+BOOST_AUTO_TEST_CASE( persistent_homology_twist )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  simplex_tree_stream.close();
+  st.initialize_filtration();
+
+  for (int coefficient : {2, 3, 11}) {
+    test_persistent_homology(st, coefficient, 0., false);
+    test_persistent_homology(st, coefficient, 0.5, false);
+    test_persistent_homology(st, coefficient, 0., true);
+  }
+
+  typeST flag_st;
+  flag_complex_on_torus_grid(flag_st);
+
+  for (int coefficient : {2, 3}) {
+    test_persistent_homology(flag_st, coefficient, 0., false);
+    test_persistent_homology(flag_st, coefficient, 0., true);
+  }
+}
+
 /** SimplexTree minimal options to test the limits.
  * 
  * Maximum number of simplices to compute persistence is <CODE>std::numeric_limits<std::uint8_t>::max()<\CODE> = 256.*/
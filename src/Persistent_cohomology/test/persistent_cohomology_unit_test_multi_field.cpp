@@ -4,6 +4,8 @@
 #include <utility> // std::pair, std::make_pair
 #include <cmath> // float comparison
 #include <limits>
+#include <vector>
+#include <sstream>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "persistent_cohomology_multi_field"
@@ -21,6 +23,7 @@ using namespace boost::unit_test;
 
 typedef Simplex_tree<> typeST;
 
+template<class ColumnStorage = Intrusive_column_storage>
 std::string test_rips_persistence(int min_coefficient, int max_coefficient, double min_persistence) {
   // file is copied in CMakeLists.txt
   std::ifstream simplex_tree_stream;
@@ -41,7 +44,7 @@ std::string test_rips_persistence(int min_coefficient, int max_coefficient, doub
   st.initialize_filtration();
 
   // Compute the persistence diagram of the complex
-  Persistent_cohomology<Simplex_tree<>, Multi_field> pcoh(st);
+  Persistent_cohomology<Simplex_tree<>, Multi_field, ColumnStorage> pcoh(st);
 
   pcoh.init_coefficients(min_coefficient, max_coefficient); // initializes the coefficient field for homology
   // Check infinite rips
@@ -106,6 +109,22 @@ BOOST_AUTO_TEST_CASE(rips_persistent_cohomology_multi_field_dim_1_5) {
   test_rips_persistence_in_dimension(1, 5);
 }
 
+std::vector<std::string> sorted_lines(const std::string& str) {
+  std::vector<std::string> lines;
+  std::istringstream iss(str);
+  for (std::string line; std::getline(iss, line);) lines.push_back(line);
+  std::sort(lines.begin(), lines.end());
+  return lines;
+}
+
+BOOST_AUTO_TEST_CASE(rips_persistent_cohomology_multi_field_flat_column_storage) {
+  for (auto min_max : {std::make_pair(0, 1), std::make_pair(1, 3), std::make_pair(1, 5)}) {
+    std::string intrusive_persistence = test_rips_persistence(min_max.first, min_max.second, 0.0);
+    std::string flat_persistence = test_rips_persistence<Flat_column_storage>(min_max.first, min_max.second, 0.0);
+    BOOST_CHECK(sorted_lines(intrusive_persistence) == sorted_lines(flat_persistence));
+  }
+}
+
 // TODO(VR): not working from 6
 // std::string str_rips_persistence = test_rips_persistence(6, 0);
 // TODO(VR): division by zero
@@ -102,8 +102,27 @@ namespace rips_complex {
  * number of higher-dimensional simplices may not be monotonous when
  * \f$\frac12\leq\epsilon\leq 1\f$.
  *
+ * \section ripsedgecollapse Edge collapse
+ *
+ * Before the expansion, `Rips_complex::collapse_edges` removes the edges of the Rips graph that are dominated, with
+ * `Flag_complex_edge_collapser` \cite edgecollapsesocg2020 \cite edgecollapsearxiv. Some of the remaining edges get a
+ * larger filtration value. The flag filtration of the collapsed graph has the same persistence diagram as the Rips
+ * filtration (up to intervals of length 0), in the dimensions lower than the maximal dimension of the expansion, but
+ * it usually has orders of magnitude fewer simplices on dense point clouds. The same filter is available on any
+ * `Gudhi::Proximity_graph` with `collapse_edges()`.
+ *
+ * \section ripspersistenceengine Persistence without a simplicial complex
+ *
+ * When only the persistence diagram of the Rips filtration is required, `Rips_persistence_engine` computes it
+ * directly from the proximity graph, without inserting the simplices in a `Simplex_tree`. Simplices are encoded by
+ * their index in the combinatorial number system and their cofacets are enumerated on the fly, so the memory usage
+ * depends on the number of simplices of one dimension and of the pivots of the reduction, instead of the total number
+ * of simplices of the complex. The intervals of positive length are the same as the ones computed by
+ * `Gudhi::persistent_cohomology::Persistent_cohomology` on the complex created by `Rips_complex::create_complex`
+ * with the same maximal dimension.
+ *
  * \section ripspointsdistance Point cloud and distance function
- * 
+ *
  * \subsection ripspointscloudexample Example from a point cloud and a distance function
  * 
  * This example builds the one skeleton graph from the given points, threshold value, and distance function.
@@ -0,0 +1,262 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef FLAG_COMPLEX_EDGE_COLLAPSER_H_
+#define FLAG_COMPLEX_EDGE_COLLAPSER_H_
+
+#include <gudhi/graph_simplicial_complex.h>
+
+#include <boost/graph/adjacency_list.hpp>
+
+#include <vector>
+#include <algorithm>  // for std::sort, std::lower_bound, std::make_heap, std::pop_heap
+#include <functional>  // for std::greater
+#include <tuple>
+#include <utility>  // for std::pair
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Flag_complex_edge_collapser
+ * \brief Removes dominated edges from a filtered graph, while preserving the persistent homology of its flag
+ * filtration.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * An edge \f$[u,v]\f$ is dominated by a vertex \f$w\f$ in a graph if \f$w\f$ is adjacent to \f$u\f$, \f$v\f$ and
+ * to all their common neighbors. The flag complex of the graph collapses on the flag complex of the graph without
+ * this edge \cite edgecollapsesocg2020.
+ *
+ * The edges are processed by decreasing filtration value. An edge that is dominated at its filtration value is
+ * removed if it stays dominated (possibly by different vertices) until the end of the filtration, or its
+ * filtration value is increased up to the first value where it is not dominated anymore
+ * \cite edgecollapsearxiv. The flag filtration of the resulting graph has the same persistence diagram as the
+ * input one, up to intervals of length 0, but it usually has much fewer edges, and even fewer simplices once
+ * expanded.
+ *
+ * \tparam Vertex_handle type of the vertices. Vertices are expected to be indices from 0 to the number of vertices
+ * minus one.
+ * \tparam Filtration_value type of the filtration values of the edges.
+ */
+template<typename Vertex_handle, typename Filtration_value>
+class Flag_complex_edge_collapser {
+ public:
+  /** \brief Edge with its filtration value. */
+  using Filtered_edge = std::tuple<Vertex_handle, Vertex_handle, Filtration_value>;
+
+ private:
+  // Neighbor of a vertex, with the filtration value of the edge.
+  using Neighbor = std::pair<Vertex_handle, Filtration_value>;
+  // Common neighbor of the two vertices of an edge, with the time it becomes a common neighbor.
+  using Timed_vertex = std::pair<Filtration_value, Vertex_handle>;
+
+ public:
+  /** \brief Collapses the dominated edges of a filtered graph.
+   *
+   * @param[in] edges Range of `Filtered_edge`. Each edge must appear only once.
+   * @return The edges of the collapsed graph with their new filtration values, sorted by increasing filtration
+   * value.
+   */
+  template<typename FilteredEdgeRange>
+  std::vector<Filtered_edge> collapse_edges(const FilteredEdgeRange& edges) {
+    std::vector<Filtered_edge> sorted_edges(std::begin(edges), std::end(edges));
+    std::sort(sorted_edges.begin(), sorted_edges.end(), [](const Filtered_edge& e1, const Filtered_edge& e2) {
+      return std::get<2>(e1) > std::get<2>(e2);
+    });
+    read_edges(sorted_edges);
+
+    std::vector<Filtered_edge> collapsed_edges;
+    collapsed_edges.reserve(sorted_edges.size());
+    for (auto& edge : sorted_edges) {
+      Vertex_handle u = std::get<0>(edge);
+      Vertex_handle v = std::get<1>(edge);
+      Filtration_value time = std::get<2>(edge);
+      if (u == v) continue;
+      if (critical_value(u, v, time)) {
+        if (time != std::get<2>(edge)) set_filtration(u, v, time);
+        collapsed_edges.emplace_back(u, v, time);
+      } else {
+        remove_edge(u, v);
+      }
+    }
+    std::reverse(collapsed_edges.begin(), collapsed_edges.end());
+    std::stable_sort(collapsed_edges.begin(), collapsed_edges.end(),
+                     [](const Filtered_edge& e1, const Filtered_edge& e2) {
+                       return std::get<2>(e1) < std::get<2>(e2);
+                     });
+    return collapsed_edges;
+  }
+
+ private:
+  // Builds the sorted neighborhoods of the vertices.
+  void read_edges(const std::vector<Filtered_edge>& edges) {
+    Vertex_handle num_vertices = 0;
+    for (auto& edge : edges)
+      num_vertices = std::max(num_vertices, static_cast<Vertex_handle>(std::max(std::get<0>(edge),
+                                                                                std::get<1>(edge)) + 1));
+    neighbors_.assign(num_vertices, std::vector<Neighbor>());
+    for (auto& edge : edges) {
+      if (std::get<0>(edge) == std::get<1>(edge)) continue;
+      neighbors_[std::get<0>(edge)].emplace_back(std::get<1>(edge), std::get<2>(edge));
+      neighbors_[std::get<1>(edge)].emplace_back(std::get<0>(edge), std::get<2>(edge));
+    }
+    for (auto& neighbors : neighbors_)
+      std::sort(neighbors.begin(), neighbors.end());
+  }
+
+  typename std::vector<Neighbor>::iterator find_neighbor(Vertex_handle u, Vertex_handle v) {
+    return std::lower_bound(neighbors_[u].begin(), neighbors_[u].end(), v,
+                            [](const Neighbor& n, Vertex_handle w) { return n.first < w; });
+  }
+
+  // Returns true iff the edge [u,v] is in the current graph at the given time.
+  bool is_adjacent(Vertex_handle u, Vertex_handle v, Filtration_value time) {
+    auto it = find_neighbor(u, v);
+    return it != neighbors_[u].end() && it->first == v && it->second <= time;
+  }
+
+  void set_filtration(Vertex_handle u, Vertex_handle v, Filtration_value time) {
+    find_neighbor(u, v)->second = time;
+    find_neighbor(v, u)->second = time;
+  }
+
+  void remove_edge(Vertex_handle u, Vertex_handle v) {
+    neighbors_[u].erase(find_neighbor(u, v));
+    neighbors_[v].erase(find_neighbor(v, u));
+  }
+
+  // Splits the common neighbors of u and v between the ones at the given time, sorted by vertex, and the later ones.
+  void common_neighbors(Vertex_handle u, Vertex_handle v, Filtration_value time) {
+    current_neighbors_.clear();
+    later_neighbors_.clear();
+    auto u_it = neighbors_[u].begin();
+    auto v_it = neighbors_[v].begin();
+    while (u_it != neighbors_[u].end() && v_it != neighbors_[v].end()) {
+      if (u_it->first < v_it->first) {
+        ++u_it;
+      } else if (v_it->first < u_it->first) {
+        ++v_it;
+      } else {
+        Filtration_value neighbor_time = std::max(u_it->second, v_it->second);
+        if (neighbor_time <= time)
+          current_neighbors_.push_back(u_it->first);
+        else
+          later_neighbors_.emplace_back(neighbor_time, u_it->first);
+        ++u_it;
+        ++v_it;
+      }
+    }
+    std::make_heap(later_neighbors_.begin(), later_neighbors_.end(), std::greater<Timed_vertex>());
+  }
+
+  // Returns true iff w is adjacent to all the current common neighbors at the given time.
+  bool is_dominated_by(Vertex_handle w, Filtration_value time) {
+    for (auto x : current_neighbors_) {
+      if (x != w && !is_adjacent(w, x, time)) return false;
+    }
+    return true;
+  }
+
+  // Adds to the current common neighbors the ones that appear at the next time, returned in time.
+  // Returns false if there is no later common neighbor. If dominator is not adjacent to one of them, it is set to
+  // null_vertex.
+  bool next_neighbors(Filtration_value& time, Vertex_handle& dominator, Vertex_handle null_vertex) {
+    if (later_neighbors_.empty()) return false;
+    time = later_neighbors_.front().first;
+    while (!later_neighbors_.empty() && later_neighbors_.front().first == time) {
+      std::pop_heap(later_neighbors_.begin(), later_neighbors_.end(), std::greater<Timed_vertex>());
+      Vertex_handle x = later_neighbors_.back().second;
+      later_neighbors_.pop_back();
+      current_neighbors_.insert(std::lower_bound(current_neighbors_.begin(), current_neighbors_.end(), x), x);
+      if (dominator != null_vertex && !is_adjacent(dominator, x, time)) dominator = null_vertex;
+    }
+    return true;
+  }
+
+  // Returns false if the edge [u,v] is dominated from the given time until the end of the filtration. Otherwise,
+  // time is set to the first value from which the edge is not dominated.
+  bool critical_value(Vertex_handle u, Vertex_handle v, Filtration_value& time) {
+    const Vertex_handle null_vertex = static_cast<Vertex_handle>(neighbors_.size());
+    common_neighbors(u, v, time);
+    while (true) {
+      Vertex_handle dominator = null_vertex;
+      for (auto w : current_neighbors_) {
+        if (is_dominated_by(w, time)) {
+          dominator = w;
+          break;
+        }
+      }
+      if (dominator == null_vertex) return true;
+      // The edge stays dominated by dominator until a new common neighbor is not adjacent to it.
+      while (dominator != null_vertex) {
+        if (!next_neighbors(time, dominator, null_vertex)) return false;
+      }
+    }
+  }
+
+ private:
+  std::vector<std::vector<Neighbor>> neighbors_;
+  std::vector<Vertex_handle> current_neighbors_;
+  std::vector<Timed_vertex> later_neighbors_;
+};
+
+/** \brief Collapses the dominated edges of a proximity graph, like the one computed by
+ * `Gudhi::compute_proximity_graph`, with `Flag_complex_edge_collapser`.
+ *
+ * \ingroup rips_complex
+ *
+ * The vertices and their filtration values are kept. The flag filtration of the resulting graph has the same
+ * persistence diagram as the one of the input graph, up to intervals of length 0, but its simplices and their
+ * filtration values differ.
+ *
+ * \tparam OneSkeletonGraph is a `Gudhi::Proximity_graph`, or any boost adjacency_list with vecS vertices and
+ * `Gudhi::edge_filtration_t` and `Gudhi::vertex_filtration_t` properties.
+ */
+template<typename OneSkeletonGraph>
+void collapse_edges(OneSkeletonGraph& graph) {
+  using Vertex_handle = typename boost::graph_traits<OneSkeletonGraph>::vertices_size_type;
+  using Filtration_value = typename boost::property_traits<
+      typename boost::property_map<OneSkeletonGraph, edge_filtration_t>::type>::value_type;
+  using Edge_collapser = Flag_complex_edge_collapser<Vertex_handle, Filtration_value>;
+
+  std::vector<typename Edge_collapser::Filtered_edge> edges;
+  auto edge_prop = boost::get(edge_filtration_t(), graph);
+  typename boost::graph_traits<OneSkeletonGraph>::edge_iterator ei, ei_end;
+  for (std::tie(ei, ei_end) = boost::edges(graph); ei != ei_end; ++ei) {
+    edges.emplace_back(boost::source(*ei, graph), boost::target(*ei, graph), boost::get(edge_prop, *ei));
+  }
+
+  Edge_collapser collapser;
+  edges = collapser.collapse_edges(edges);
+
+  std::vector<std::pair<Vertex_handle, Vertex_handle>> collapsed_edges;
+  std::vector<Filtration_value> collapsed_edges_fil;
+  collapsed_edges.reserve(edges.size());
+  collapsed_edges_fil.reserve(edges.size());
+  for (auto& edge : edges) {
+    collapsed_edges.emplace_back(std::get<0>(edge), std::get<1>(edge));
+    collapsed_edges_fil.push_back(std::get<2>(edge));
+  }
+  OneSkeletonGraph collapsed_graph(collapsed_edges.begin(), collapsed_edges.end(), collapsed_edges_fil.begin(),
+                                   boost::num_vertices(graph));
+  auto vertex_prop = boost::get(vertex_filtration_t(), graph);
+  auto collapsed_vertex_prop = boost::get(vertex_filtration_t(), collapsed_graph);
+  typename boost::graph_traits<OneSkeletonGraph>::vertex_iterator vi, vi_end;
+  for (std::tie(vi, vi_end) = boost::vertices(graph); vi != vi_end; ++vi) {
+    boost::put(collapsed_vertex_prop, *vi, boost::get(vertex_prop, *vi));
+  }
+  graph.swap(collapsed_graph);
+}
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // FLAG_COMPLEX_EDGE_COLLAPSER_H_
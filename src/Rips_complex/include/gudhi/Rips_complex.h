@@ -13,6 +13,7 @@
 
 #include <gudhi/Debug_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/Flag_complex_edge_collapser.h>
 
 #include <boost/graph/adjacency_list.hpp>
 
@@ -61,11 +62,12 @@ class Rips_complex {
    * @param[in] threshold Rips value.
    * @param[in] distance distance function that returns a `Filtration_value` from 2 given points.
    * 
-   * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return input iterators on a
-   * point.
+   * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return random access iterators
+   * on a point.
    *
    * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
-   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`. It is called concurrently
+   * from several threads if GUDHI is built with TBB, and must thus be thread safe.
    */
   template<typename ForwardPointRange, typename Distance >
   Rips_complex(const ForwardPointRange& points, Filtration_value threshold, Distance distance) {
@@ -108,6 +110,17 @@ class Rips_complex {
     complex.expansion(dim_max);
   }
 
+  /** \brief Removes the dominated edges of the Rips graph, with `Flag_complex_edge_collapser`.
+   *
+   * The complex created afterwards by `create_complex` is usually much smaller, and its filtration has the same
+   * persistence diagram as the Rips filtration, up to intervals of length 0. Its simplices and their filtration
+   * values are not the ones of the Rips complex though, and persistence is only preserved in the dimensions lower
+   * than `dim_max`.
+   */
+  void collapse_edges() {
+    rips_complex::collapse_edges(rips_skeleton_graph_);
+  }
+
  private:
   /** \brief Computes the proximity graph of the points.
    *
@@ -118,7 +131,7 @@ class Rips_complex {
    * methods.
    *
    * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
-   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`. It must be thread safe.
    */
   template< typename ForwardPointRange, typename Distance >
   void compute_proximity_graph(const ForwardPointRange& points, Filtration_value threshold,
@@ -130,18 +143,9 @@ class Rips_complex {
     // If points contains n elements, the proximity graph is the graph with n vertices, and an edge [u,v] iff the
     // distance function between points u and v is smaller than threshold.
     // --------------------------------------------------------------------------------------------
-    // Creates the vector of edges and its filtration values (returned by distance function)
-    Vertex_handle idx_u = 0;
-    for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
-      Vertex_handle idx_v = idx_u + 1;
-      for (auto it_v = it_u + 1; it_v != std::end(points); ++it_v, ++idx_v) {
-        Filtration_value fil = distance(*it_u, *it_v);
-        if (fil <= threshold) {
-          edges.emplace_back(idx_u, idx_v);
-          edges_fil.push_back(fil);
-        }
-      }
-    }
+    // Creates the vector of edges and its filtration values (returned by distance function), in parallel if TBB is
+    // available
+    std::size_t idx_u = Gudhi::compute_proximity_edges(points, threshold, distance, edges, edges_fil);
 
     // --------------------------------------------------------------------------------------------
     // Creates the proximity graph from edges and sets the property with the filtration value.
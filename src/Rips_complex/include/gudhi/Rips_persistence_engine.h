@@ -0,0 +1,551 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef RIPS_PERSISTENCE_ENGINE_H_
+#define RIPS_PERSISTENCE_ENGINE_H_
+
+#include <gudhi/Debug_utils.h>
+#include <gudhi/Persistent_cohomology/Field_Zp.h>
+
+#include <boost/range/irange.hpp>
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <algorithm>  // for std::sort, std::max
+#include <limits>  // for numeric_limits
+#include <tuple>
+#include <utility>  // for pair<>
+#include <cstdint>  // for std::uint64_t
+#include <stdexcept>  // for std::out_of_range
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Rips_persistence_engine
+ * \brief Computes the persistent cohomology of a Rips filtration without building the simplicial complex.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * The engine only stores the proximity graph (one sorted neighborhood per vertex). Simplices are never
+ * materialized: a simplex is identified by its index in the combinatorial number system, its vertices are decoded
+ * from this index and its cofacets are enumerated on the fly by intersecting the neighborhoods of its vertices.
+ *
+ * Cohomology is computed dimension by dimension. Columns that are known to be zero (simplices that are the death of
+ * a pair in the previous dimension) are cleared before the reduction, and apparent pairs (a simplex and its
+ * youngest cofacet of same filtration value) are detected without any column operation. The reduction only keeps
+ * in memory the simplices of the current dimension and the cocycle representatives of the pivots, instead of all
+ * the simplices of the complex as `Rips_complex::create_complex` followed by
+ * `Gudhi::persistent_cohomology::Persistent_cohomology` does.
+ *
+ * The intervals of non-zero length are the same as the ones that would be obtained with
+ * `Rips_complex::create_complex` on a `Simplex_tree` with the same `dim_max`, followed by
+ * `Persistent_cohomology::compute_persistent_cohomology`. Zero length intervals depend on the order of simplices
+ * with the same filtration value and may differ.
+ *
+ * \tparam Filtration_value is the type used to store the filtration values of the simplicial complex.
+ */
+template<typename Filtration_value>
+class Rips_persistence_engine {
+ public:
+  /** \brief Type of the coefficient field. */
+  typedef Gudhi::persistent_cohomology::Field_Zp Coefficient_field;
+  /** \brief Type of element of the field. */
+  typedef typename Coefficient_field::Element Arith_element;
+  /** \brief Type of a persistence interval: dimension, birth and death. Death is infinity for essential classes. */
+  typedef std::tuple<int, Filtration_value, Filtration_value> Persistent_interval;
+
+ private:
+  typedef int Vertex_handle;
+  // Index of a simplex in the combinatorial number system.
+  typedef std::uint64_t Simplex_index;
+
+  struct Entry {
+    Filtration_value diameter;
+    Simplex_index index;
+    Arith_element coefficient;
+  };
+
+  // Order of the simplices in the reversed filtration: greater diameter first, then smaller index first.
+  struct Greater_diameter_or_smaller_index {
+    bool operator()(const Entry& a, const Entry& b) const {
+      return (a.diameter > b.diameter) || ((a.diameter == b.diameter) && (a.index < b.index));
+    }
+  };
+
+  // std::priority_queue puts on top the entry that is the greatest for the comparison: here the entry of smallest
+  // diameter, then of largest index among equal diameters, i.e. the first one in the filtration order of the
+  // coboundary, which is the pivot.
+  typedef std::priority_queue<Entry, std::vector<Entry>, Greater_diameter_or_smaller_index> Working_column;
+  // Simplex_index of a pivot -> position of its column in the columns to reduce, and pivot coefficient.
+  typedef std::unordered_map<Simplex_index, std::pair<std::size_t, Arith_element>> Pivot_column_index;
+
+  typedef std::vector<std::pair<Vertex_handle, Filtration_value>> Neighborhood;
+
+ public:
+  /** \brief Rips_persistence_engine constructor from a list of points.
+   *
+   * @param[in] points Range of points.
+   * @param[in] threshold Rips value.
+   * @param[in] distance distance function that returns a `Filtration_value` from 2 given points.
+   *
+   * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return input iterators on a
+   * point.
+   *
+   * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   */
+  template<typename ForwardPointRange, typename Distance >
+  Rips_persistence_engine(const ForwardPointRange& points, Filtration_value threshold, Distance distance) {
+    compute_neighborhoods(points, threshold, distance);
+  }
+
+  /** \brief Rips_persistence_engine constructor from a distance matrix.
+   *
+   * @param[in] distance_matrix Range of distances.
+   * @param[in] threshold Rips value.
+   *
+   * \tparam DistanceMatrix must have a `size()` method and on which `distance_matrix[i][j]` returns
+   * the distance between points \f$i\f$ and \f$j\f$ as long as \f$ 0 \leqslant j < i \leqslant
+   * distance\_matrix.size().\f$
+   */
+  template<typename DistanceMatrix>
+  Rips_persistence_engine(const DistanceMatrix& distance_matrix, Filtration_value threshold) {
+    compute_neighborhoods(boost::irange((size_t)0, distance_matrix.size()), threshold,
+                          [&](size_t i, size_t j){return distance_matrix[j][i];});
+  }
+
+  /** \brief Initializes the coefficient field.*/
+  void init_coefficients(int charac) {
+    coeff_field_.init(charac);
+  }
+
+  /** \brief Computes the persistent cohomology of the Rips filtration expanded until a given maximal dimension.
+   *
+   * @param[in] dim_max graph expansion for Rips until this given maximal dimension, as in
+   * `Rips_complex::create_complex`. Persistence is computed up to dimension `dim_max - 1`.
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   * @exception std::out_of_range In case the number of simplices of dimension `dim_max` cannot be indexed on 64 bits.
+   *
+   * `init_coefficients` must have been called before. */
+  void compute_persistent_cohomology(int dim_max, Filtration_value min_interval_length = 0) {
+    GUDHI_CHECK(coeff_field_.characteristic() > 0,
+                std::invalid_argument("Rips_persistence_engine::compute_persistent_cohomology - "
+                                      "init_coefficients must be called first"));
+    persistent_pairs_.clear();
+    min_interval_length_ = min_interval_length;
+    // Rips_complex::create_complex always contains the 1-skeleton
+    int dim_homology_max = (std::max)(dim_max, 1) - 1;
+    compute_binomial_coefficients(dim_homology_max + 2);
+
+    std::vector<Entry> simplices;
+    std::vector<Entry> columns_to_reduce;
+    compute_dim_0_pairs(simplices, columns_to_reduce);
+
+    for (int dim = 1; dim <= dim_homology_max; ++dim) {
+      Pivot_column_index pivot_column_index;
+      pivot_column_index.reserve(columns_to_reduce.size());
+      std::vector<Filtration_value> essential_births;
+      compute_pairs(columns_to_reduce, pivot_column_index, dim, essential_births);
+      // As in Persistent_cohomology, infinite intervals are only reported when the complex has simplices of higher
+      // dimension.
+      if (!essential_births.empty() && has_cofacet(simplices, dim)) {
+        for (Filtration_value birth : essential_births)
+          add_interval(dim, birth, std::numeric_limits<Filtration_value>::infinity());
+      }
+      if (dim < dim_homology_max) {
+        assemble_columns_to_reduce(simplices, columns_to_reduce, pivot_column_index, dim + 1);
+      }
+    }
+  }
+
+  /** @brief Returns a list of persistence intervals as (dimension, birth, death) tuples.
+   * @return A list of Rips_persistence_engine::Persistent_interval
+   */
+  const std::vector<Persistent_interval>& get_persistent_pairs() const {
+    return persistent_pairs_;
+  }
+
+  /** @brief Returns persistence intervals for a given dimension.
+   * @param[in] dimension Dimension to get the birth and death pairs from.
+   * @return A vector of persistence intervals (birth and death) on a fixed dimension.
+   */
+  std::vector< std::pair< Filtration_value , Filtration_value > >
+  intervals_in_dimension(int dimension) const {
+    std::vector< std::pair< Filtration_value , Filtration_value > > result;
+    for (auto && pair : persistent_pairs_) {
+      if (std::get<0>(pair) == dimension) {
+        result.emplace_back(std::get<1>(pair), std::get<2>(pair));
+      }
+    }
+    return result;
+  }
+
+  /** \brief Output the persistence diagram in ostream, with the same format as
+   * `Persistent_cohomology::output_diagram`:
+   *    p   dim b d
+   */
+  void output_diagram(std::ostream& ostream = std::cout) {
+    std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_),
+              [](const Persistent_interval& p1, const Persistent_interval& p2) {
+                return std::get<2>(p1) - std::get<1>(p1) > std::get<2>(p2) - std::get<1>(p2);
+              });
+    for (auto pair : persistent_pairs_) {
+      ostream << coeff_field_.characteristic() << "  " << std::get<0>(pair) << " " << std::get<1>(pair) << " ";
+      if (std::get<2>(pair) == std::numeric_limits<Filtration_value>::infinity())
+        ostream << "inf " << std::endl;
+      else
+        ostream << std::get<2>(pair) << " " << std::endl;
+    }
+  }
+
+ private:
+  /* Computes the neighborhood of each point, i.e. the proximity graph, sorted by vertex index. */
+  template< typename ForwardPointRange, typename Distance >
+  void compute_neighborhoods(const ForwardPointRange& points, Filtration_value threshold, Distance distance) {
+    Vertex_handle idx_u = 0;
+    for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
+      neighbors_.emplace_back();
+    }
+    idx_u = 0;
+    for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
+      Vertex_handle idx_v = idx_u + 1;
+      for (auto it_v = std::next(it_u); it_v != std::end(points); ++it_v, ++idx_v) {
+        Filtration_value fil = distance(*it_u, *it_v);
+        if (fil <= threshold) {
+          // idx_v increases, so both neighborhoods remain sorted
+          neighbors_[idx_u].emplace_back(idx_v, fil);
+          neighbors_[idx_v].emplace_back(idx_u, fil);
+        }
+      }
+    }
+  }
+
+  /* binomial_coeff_[n][k] = n choose k, for k <= max_k. */
+  void compute_binomial_coefficients(int max_k) {
+    std::size_t n = neighbors_.size();
+    binomial_coeff_.assign(n + 1, std::vector<Simplex_index>(max_k + 1, 0));
+    for (std::size_t i = 0; i <= n; ++i) {
+      binomial_coeff_[i][0] = 1;
+      for (int j = 1; j <= (std::min)(static_cast<int>(i), max_k); ++j) {
+        Simplex_index a = binomial_coeff_[i - 1][j - 1];
+        Simplex_index b = (static_cast<int>(i) - 1 >= j) ? binomial_coeff_[i - 1][j] : 0;
+        if (a > std::numeric_limits<Simplex_index>::max() - b)
+          throw std::out_of_range("The number of simplices is more than the Simplex_index type numeric limit.");
+        binomial_coeff_[i][j] = a + b;
+      }
+    }
+  }
+
+  /* Index of the simplex with the given vertices, sorted by decreasing order. */
+  Simplex_index simplex_index(const std::vector<Vertex_handle>& vertices) const {
+    Simplex_index index = 0;
+    int k = static_cast<int>(vertices.size());
+    for (Vertex_handle v : vertices) {
+      index += binomial_coeff_[v][k--];
+    }
+    return index;
+  }
+
+  /* Decodes the vertices, by decreasing order, of the simplex of dimension dim with the given index. */
+  void simplex_vertices(Simplex_index index, int dim, std::vector<Vertex_handle>& vertices) const {
+    vertices.clear();
+    Vertex_handle n = static_cast<Vertex_handle>(neighbors_.size());
+    for (int k = dim + 1; k > 0; --k) {
+      // Largest v such that (v choose k) <= index
+      Vertex_handle lo = k - 1, hi = n - 1;
+      while (lo < hi) {
+        Vertex_handle mid = lo + (hi - lo + 1) / 2;
+        if (binomial_coeff_[mid][k] <= index)
+          lo = mid;
+        else
+          hi = mid - 1;
+      }
+      vertices.push_back(lo);
+      index -= binomial_coeff_[lo][k];
+      n = lo;
+    }
+  }
+
+  /* Calls cofacet(Entry) on every cofacet of the simplex, by decreasing order of index, while it returns true.
+   * The cofacet coefficients are the ones of the coboundary of the simplex multiplied by simplex.coefficient.
+   * If only_top is true, only the cofacets whose new vertex is bigger than all the vertices of the simplex are
+   * considered, which enumerates every simplex of dimension dim + 1 exactly once over all simplices of dimension dim.
+   */
+  template<typename CofacetFunction>
+  void for_each_cofacet(const Entry& simplex, int dim, bool only_top, CofacetFunction cofacet) {
+#ifdef GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    thread_local
+#endif  // GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    std::vector<Vertex_handle> vertices;
+#ifdef GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    thread_local
+#endif  // GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    std::vector<std::ptrdiff_t> positions;
+    simplex_vertices(simplex.index, dim, vertices);
+    std::size_t num_vertices = vertices.size();
+    positions.clear();
+    for (Vertex_handle v : vertices)
+      positions.push_back(static_cast<std::ptrdiff_t>(neighbors_[v].size()) - 1);
+
+    // Reverse traversal of the neighborhoods of all the vertices, looking for common neighbors.
+    const Neighborhood& first_neighborhood = neighbors_[vertices[0]];
+    for (; positions[0] >= 0; --positions[0]) {
+      Vertex_handle candidate = first_neighborhood[positions[0]].first;
+      if (only_top && candidate < vertices[0])
+        return;
+      Filtration_value diameter = (std::max)(simplex.diameter, first_neighborhood[positions[0]].second);
+      bool is_common_neighbor = true;
+      for (std::size_t i = 1; i < num_vertices; ++i) {
+        const Neighborhood& neighborhood = neighbors_[vertices[i]];
+        while (positions[i] >= 0 && neighborhood[positions[i]].first > candidate)
+          --positions[i];
+        if (positions[i] < 0)
+          return;
+        if (neighborhood[positions[i]].first != candidate) {
+          is_common_neighbor = false;
+          break;
+        }
+        diameter = (std::max)(diameter, neighborhood[positions[i]].second);
+      }
+      if (!is_common_neighbor)
+        continue;
+      // Index of the cofacet and sign of the simplex in its boundary, from the position of the new vertex.
+      Simplex_index index = 0;
+      std::size_t k = num_vertices + 1;
+      std::size_t num_bigger_vertices = 0;
+      for (Vertex_handle v : vertices) {
+        if (v > candidate) {
+          index += binomial_coeff_[v][k--];
+          ++num_bigger_vertices;
+        } else {
+          break;
+        }
+      }
+      index += binomial_coeff_[candidate][k--];
+      for (std::size_t i = num_bigger_vertices; i < num_vertices; ++i) {
+        index += binomial_coeff_[vertices[i]][k--];
+      }
+      Arith_element coefficient = coeff_field_.times(simplex.coefficient, (num_bigger_vertices % 2) ? -1 : 1);
+      if (!cofacet(Entry{diameter, index, coefficient}))
+        return;
+    }
+  }
+
+  /* Returns true if at least one of the simplices of dimension dim has a cofacet. */
+  bool has_cofacet(const std::vector<Entry>& simplices, int dim) {
+    bool found = false;
+    for (const Entry& simplex : simplices) {
+      for_each_cofacet(simplex, dim, true, [&](const Entry&) { found = true; return false; });
+      if (found)
+        return true;
+    }
+    return false;
+  }
+
+  void add_interval(int dim, Filtration_value birth, Filtration_value death) {
+    // Same policy as Persistent_cohomology
+    if (death - birth > min_interval_length_)
+      persistent_pairs_.emplace_back(dim, birth, death);
+  }
+
+  /* 0-dimensional persistence with a union-find on the edges sorted by filtration value. The edges that do not merge
+   * two connected components are the columns to reduce in dimension 1. */
+  void compute_dim_0_pairs(std::vector<Entry>& edges, std::vector<Entry>& columns_to_reduce) {
+    edges.clear();
+    columns_to_reduce.clear();
+    for (Vertex_handle u = 0; u < static_cast<Vertex_handle>(neighbors_.size()); ++u) {
+      for (auto& neighbor : neighbors_[u]) {
+        if (neighbor.first > u)
+          edges.push_back(Entry{neighbor.second, simplex_index({neighbor.first, u}), 1});
+      }
+    }
+    std::sort(edges.rbegin(), edges.rend(), Greater_diameter_or_smaller_index());
+
+    std::vector<Vertex_handle> parent(neighbors_.size());
+    for (std::size_t i = 0; i < parent.size(); ++i)
+      parent[i] = static_cast<Vertex_handle>(i);
+    auto find = [&](Vertex_handle v) {
+      while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+      }
+      return v;
+    };
+
+    std::vector<Vertex_handle> vertices;
+    for (const Entry& edge : edges) {
+      simplex_vertices(edge.index, 1, vertices);
+      Vertex_handle u = find(vertices[0]);
+      Vertex_handle v = find(vertices[1]);
+      if (u != v) {
+        // All vertices have a 0 filtration value.
+        add_interval(0, 0, edge.diameter);
+        parent[u] = v;
+      } else {
+        columns_to_reduce.push_back(edge);
+      }
+    }
+    std::reverse(columns_to_reduce.begin(), columns_to_reduce.end());
+
+    for (std::size_t v = 0; v < parent.size(); ++v) {
+      if (parent[v] == static_cast<Vertex_handle>(v))
+        add_interval(0, 0, std::numeric_limits<Filtration_value>::infinity());
+    }
+  }
+
+  /* Lists all the simplices of dimension dim from the ones of dimension dim - 1, and keeps as columns to reduce the
+   * ones that are not a pivot of the reduction in dimension dim - 1 (clearing). */
+  void assemble_columns_to_reduce(std::vector<Entry>& simplices, std::vector<Entry>& columns_to_reduce,
+                                  const Pivot_column_index& pivot_column_index, int dim) {
+    std::vector<Entry> next_simplices;
+    columns_to_reduce.clear();
+    for (const Entry& simplex : simplices) {
+      for_each_cofacet(Entry{simplex.diameter, simplex.index, 1}, dim - 1, true, [&](const Entry& cofacet) {
+        next_simplices.push_back(Entry{cofacet.diameter, cofacet.index, 1});
+        if (pivot_column_index.find(cofacet.index) == pivot_column_index.end())
+          columns_to_reduce.push_back(next_simplices.back());
+        return true;
+      });
+    }
+    simplices.swap(next_simplices);
+    std::sort(columns_to_reduce.begin(), columns_to_reduce.end(), Greater_diameter_or_smaller_index());
+  }
+
+  /* Pops the pivot of a working column, summing up the coefficients of identical entries. Returns an entry with
+   * a null_index() if the column is zero. */
+  Entry pop_pivot(Working_column& column) {
+    while (!column.empty()) {
+      Entry pivot = column.top();
+      column.pop();
+      while (!column.empty() && column.top().index == pivot.index) {
+        pivot.coefficient = coeff_field_.plus_equal(pivot.coefficient, column.top().coefficient);
+        column.pop();
+      }
+      if (pivot.coefficient != coeff_field_.additive_identity())
+        return pivot;
+    }
+    return Entry{0, null_index(), 0};
+  }
+
+  Entry get_pivot(Working_column& column) {
+    Entry pivot = pop_pivot(column);
+    if (pivot.index != null_index())
+      column.push(pivot);
+    return pivot;
+  }
+
+  static Simplex_index null_index() {
+    return std::numeric_limits<Simplex_index>::max();
+  }
+
+  /* Pushes the coboundary of simplex in working_coboundary, and returns its pivot. If the pivot is an apparent
+   * pair, i.e. the youngest cofacet has the same filtration value and is not already paired, it is returned without
+   * filling working_coboundary. */
+  Entry init_coboundary_and_get_pivot(const Entry& simplex, int dim, Working_column& working_coboundary,
+                                      const Pivot_column_index& pivot_column_index) {
+#ifdef GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    thread_local
+#endif  // GUDHI_CAN_USE_CXX11_THREAD_LOCAL
+    std::vector<Entry> cofacets;
+    cofacets.clear();
+    bool check_for_apparent_pair = true;
+    Entry apparent_pivot{0, null_index(), 0};
+    for_each_cofacet(simplex, dim, false, [&](const Entry& cofacet) {
+      if (check_for_apparent_pair && cofacet.diameter == simplex.diameter) {
+        if (pivot_column_index.find(cofacet.index) == pivot_column_index.end()) {
+          apparent_pivot = cofacet;
+          return false;
+        }
+        check_for_apparent_pair = false;
+      }
+      cofacets.push_back(cofacet);
+      return true;
+    });
+    if (apparent_pivot.index != null_index())
+      return apparent_pivot;
+    for (const Entry& cofacet : cofacets)
+      working_coboundary.push(cofacet);
+    return get_pivot(working_coboundary);
+  }
+
+  /* Reduction of the coboundary matrix in dimension dim. */
+  void compute_pairs(const std::vector<Entry>& columns_to_reduce, Pivot_column_index& pivot_column_index, int dim,
+                     std::vector<Filtration_value>& essential_births) {
+    // Cocycle representatives of the reduced columns, stored contiguously.
+    std::vector<Entry> reduction_entries;
+    std::vector<std::size_t> reduction_bounds;
+    reduction_bounds.reserve(columns_to_reduce.size() + 1);
+    reduction_bounds.push_back(0);
+
+    for (std::size_t index_column_to_reduce = 0; index_column_to_reduce < columns_to_reduce.size();
+         ++index_column_to_reduce) {
+      Entry column_to_reduce = columns_to_reduce[index_column_to_reduce];
+      column_to_reduce.coefficient = coeff_field_.multiplicative_identity();
+      Filtration_value birth = column_to_reduce.diameter;
+
+      Working_column working_reduction_column;
+      Working_column working_coboundary;
+      working_reduction_column.push(column_to_reduce);
+      Entry pivot = init_coboundary_and_get_pivot(column_to_reduce, dim, working_coboundary, pivot_column_index);
+
+      while (true) {
+        if (pivot.index == null_index()) {
+          essential_births.push_back(birth);
+          break;
+        }
+        auto pair = pivot_column_index.find(pivot.index);
+        if (pair == pivot_column_index.end()) {
+          add_interval(dim, birth, pivot.diameter);
+          pivot_column_index.emplace(pivot.index, std::make_pair(index_column_to_reduce, pivot.coefficient));
+          // Store the cocycle representative of the column, for later additions.
+          for (Entry e = pop_pivot(working_reduction_column); e.index != null_index();
+               e = pop_pivot(working_reduction_column)) {
+            reduction_entries.push_back(e);
+          }
+          break;
+        }
+        // working <- working - (pivot / other_pivot) * other_column
+        std::size_t index_column_to_add = pair->second.first;
+        Arith_element factor = coeff_field_.times_minus(pivot.coefficient,
+                                                        coeff_field_.inverse(pair->second.second,
+                                                                             coeff_field_.characteristic()).first);
+        for (std::size_t i = reduction_bounds[index_column_to_add]; i < reduction_bounds[index_column_to_add + 1];
+             ++i) {
+          Entry simplex = reduction_entries[i];
+          simplex.coefficient = coeff_field_.times(simplex.coefficient, factor);
+          working_reduction_column.push(simplex);
+          for_each_cofacet(simplex, dim, false, [&](const Entry& cofacet) {
+            working_coboundary.push(cofacet);
+            return true;
+          });
+        }
+        pivot = get_pivot(working_coboundary);
+      }
+
+      reduction_bounds.push_back(reduction_entries.size());
+    }
+  }
+
+ private:
+  std::vector<Neighborhood> neighbors_;
+  std::vector<std::vector<Simplex_index>> binomial_coeff_;
+  Coefficient_field coeff_field_;
+  Filtration_value min_interval_length_ = 0;
+  std::vector<Persistent_interval> persistent_pairs_;
+};
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // RIPS_PERSISTENCE_ENGINE_H_
@@ -17,9 +17,12 @@
 #include <string>
 #include <vector>
 #include <algorithm>    // std::max
+#include <tuple>
 
 #include <gudhi/Rips_complex.h>
 #include <gudhi/Sparse_rips_complex.h>
+#include <gudhi/Rips_persistence_engine.h>
+#include <gudhi/Persistent_cohomology.h>
 // to construct Rips_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
 #include <gudhi/Simplex_tree.h>
@@ -34,6 +37,10 @@ using Filtration_value = Simplex_tree::Filtration_value;
 using Rips_complex = Gudhi::rips_complex::Rips_complex<Simplex_tree::Filtration_value>;
 using Sparse_rips_complex = Gudhi::rips_complex::Sparse_rips_complex<Simplex_tree::Filtration_value>;
 using Distance_matrix = std::vector<std::vector<Filtration_value>>;
+using Rips_persistence_engine = Gudhi::rips_complex::Rips_persistence_engine<Filtration_value>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
+using Interval = std::tuple<int, Filtration_value, Filtration_value>;
 
 BOOST_AUTO_TEST_CASE(RIPS_DOC_OFF_file) {
   // ----------------------------------------------------------------------------
@@ -380,6 +387,131 @@ BOOST_AUTO_TEST_CASE(Rips_doc_csv_file) {
 
 }
 
+std::vector<Interval> sorted_intervals(Rips_persistence_engine& engine, int dim_max) {
+  engine.init_coefficients(11);
+  engine.compute_persistent_cohomology(dim_max);
+  std::vector<Interval> intervals(engine.get_persistent_pairs());
+  std::sort(intervals.begin(), intervals.end());
+  return intervals;
+}
+
+std::vector<Interval> sorted_intervals(Rips_complex& rips_complex, int dim_max) {
+  Simplex_tree stree;
+  rips_complex.create_complex(stree, dim_max);
+  Persistent_cohomology pcoh(stree);
+  pcoh.init_coefficients(11);
+  pcoh.compute_persistent_cohomology();
+  std::vector<Interval> intervals;
+  for (auto pair : pcoh.get_persistent_pairs()) {
+    intervals.emplace_back(stree.dimension(std::get<0>(pair)), stree.filtration(std::get<0>(pair)),
+                           stree.filtration(std::get<1>(pair)));
+  }
+  std::sort(intervals.begin(), intervals.end());
+  return intervals;
+}
+
+void check_same_intervals(const std::vector<Interval>& engine_intervals, const std::vector<Interval>& intervals) {
+  std::cout << "Engine intervals: " << engine_intervals.size() << " - Persistent_cohomology intervals: "
+      << intervals.size() << std::endl;
+  BOOST_CHECK(engine_intervals.size() == intervals.size());
+  for (std::size_t i = 0; i < (std::min)(engine_intervals.size(), intervals.size()); ++i) {
+    BOOST_CHECK(std::get<0>(engine_intervals[i]) == std::get<0>(intervals[i]));
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(std::get<1>(engine_intervals[i]), std::get<1>(intervals[i]));
+    if (std::isinf(std::get<2>(intervals[i])))
+      BOOST_CHECK(std::get<2>(engine_intervals[i]) == std::get<2>(intervals[i]));
+    else
+      GUDHI_TEST_FLOAT_EQUALITY_CHECK(std::get<2>(engine_intervals[i]), std::get<2>(intervals[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_engine_from_points) {
+  std::string off_file_name("tore3D_300.off");
+  Gudhi::Points_off_reader<Point> off_reader(off_file_name);
+
+  for (double rips_threshold : {0.5, 1.2}) {
+    Rips_complex rips_complex(off_reader.get_point_cloud(), rips_threshold, Gudhi::Euclidean_distance());
+    Rips_persistence_engine engine(off_reader.get_point_cloud(), rips_threshold, Gudhi::Euclidean_distance());
+    for (int dim_max : {1, 2, 3}) {
+      std::cout << "========== " << off_file_name << " - Rips threshold=" << rips_threshold << " - dim_max="
+          << dim_max << " ==========" << std::endl;
+      check_same_intervals(sorted_intervals(engine, dim_max), sorted_intervals(rips_complex, dim_max));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_engine_from_distance_matrix) {
+  std::string csv_file_name("full_square_distance_matrix.csv");
+  Distance_matrix distances = Gudhi::read_lower_triangular_matrix_from_csv_file<Filtration_value>(csv_file_name);
+
+  for (double rips_threshold : {12.0, std::numeric_limits<double>::infinity()}) {
+    Rips_complex rips_complex(distances, rips_threshold);
+    Rips_persistence_engine engine(distances, rips_threshold);
+    for (int dim_max : {0, 2, 4}) {
+      std::cout << "========== " << csv_file_name << " - Rips threshold=" << rips_threshold << " - dim_max="
+          << dim_max << " ==========" << std::endl;
+      check_same_intervals(sorted_intervals(engine, dim_max), sorted_intervals(rips_complex, dim_max));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_engine_without_triangles) {
+  // A square: one 1-cycle, but no triangle in the complex, so no infinite interval in dimension 1.
+  std::vector<Point> points = {{0., 0.}, {1., 0.}, {1., 1.}, {0., 1.}};
+  Rips_persistence_engine engine(points, 1.1, Gudhi::Euclidean_distance());
+  std::vector<Interval> intervals = sorted_intervals(engine, 2);
+  BOOST_CHECK(intervals.size() == 4);
+  for (auto& interval : intervals) {
+    BOOST_CHECK(std::get<0>(interval) == 0);
+  }
+  Rips_complex rips_complex(points, 1.1, Gudhi::Euclidean_distance());
+  check_same_intervals(intervals, sorted_intervals(rips_complex, 2));
+}
+
+// The collapsed complex may have a lower dimension than dim_max, so persistence is computed in all dimensions.
+std::vector<Interval> sorted_collapsed_intervals(Rips_complex& rips_complex, int dim_max) {
+  Simplex_tree stree;
+  rips_complex.create_complex(stree, dim_max);
+  std::cout << "Collapsed complex: " << stree.num_simplices() << " simplices" << std::endl;
+  Persistent_cohomology pcoh(stree, true);
+  pcoh.init_coefficients(11);
+  pcoh.compute_persistent_cohomology();
+  std::vector<Interval> intervals;
+  for (auto pair : pcoh.get_persistent_pairs()) {
+    if (stree.dimension(std::get<0>(pair)) < dim_max)
+      intervals.emplace_back(stree.dimension(std::get<0>(pair)), stree.filtration(std::get<0>(pair)),
+                             stree.filtration(std::get<1>(pair)));
+  }
+  std::sort(intervals.begin(), intervals.end());
+  return intervals;
+}
+
+BOOST_AUTO_TEST_CASE(Rips_complex_edge_collapse) {
+  std::string off_file_name("tore3D_300.off");
+  Gudhi::Points_off_reader<Point> off_reader(off_file_name);
+
+  for (double rips_threshold : {0.5, 1.2}) {
+    Rips_complex rips_complex(off_reader.get_point_cloud(), rips_threshold, Gudhi::Euclidean_distance());
+    rips_complex.collapse_edges();
+    Rips_persistence_engine engine(off_reader.get_point_cloud(), rips_threshold, Gudhi::Euclidean_distance());
+    for (int dim_max : {1, 2, 3}) {
+      std::cout << "========== " << off_file_name << " - Rips threshold=" << rips_threshold << " - dim_max="
+          << dim_max << " ==========" << std::endl;
+      check_same_intervals(sorted_intervals(engine, dim_max), sorted_collapsed_intervals(rips_complex, dim_max));
+    }
+  }
+
+  // Vertices of a regular polygon: many edges with the same filtration value.
+  std::vector<Point> points;
+  for (int i = 0; i < 12; ++i)
+    points.push_back({std::cos(i * M_PI / 6.), std::sin(i * M_PI / 6.)});
+  Rips_complex rips_complex(points, 3., Gudhi::Euclidean_distance());
+  rips_complex.collapse_edges();
+  Rips_persistence_engine engine(points, 3., Gudhi::Euclidean_distance());
+  for (int dim_max : {2, 3}) {
+    check_same_intervals(sorted_intervals(engine, dim_max), sorted_collapsed_intervals(rips_complex, dim_max));
+  }
+}
+
 #ifdef GUDHI_DEBUG
 BOOST_AUTO_TEST_CASE(Rips_create_complex_throw) {
   // ----------------------------------------------------------------------------
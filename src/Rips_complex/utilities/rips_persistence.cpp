@@ -30,7 +30,8 @@ using Point = std::vector<double>;
 using Points_off_reader = Gudhi::Points_off_reader<Point>;
 
 void program_options(int argc, char* argv[], std::string& off_file_points, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence);
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     bool& collapse);
 
 int main(int argc, char* argv[]) {
   std::string off_file_points;
@@ -39,11 +40,16 @@ int main(int argc, char* argv[]) {
   int dim_max;
   int p;
   Filtration_value min_persistence;
+  bool collapse;
 
-  program_options(argc, argv, off_file_points, filediag, threshold, dim_max, p, min_persistence);
+  program_options(argc, argv, off_file_points, filediag, threshold, dim_max, p, min_persistence, collapse);
 
   Points_off_reader off_reader(off_file_points);
   Rips_complex rips_complex_from_file(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+  if (collapse) {
+    // Remove the dominated edges, the persistence diagram is unchanged
+    rips_complex_from_file.collapse_edges();
+  }
 
   // Construct the Rips complex in a Simplex Tree
   Simplex_tree simplex_tree;
@@ -56,7 +62,8 @@ int main(int argc, char* argv[]) {
   simplex_tree.initialize_filtration();
 
   // Compute the persistence diagram of the complex
-  Persistent_cohomology pcoh(simplex_tree);
+  // The collapsed complex may have a lower dimension than dim_max, its homology is valid in all its dimensions
+  Persistent_cohomology pcoh(simplex_tree, collapse && simplex_tree.dimension() < dim_max);
   // initializes the coefficient field for homology
   pcoh.init_coefficients(p);
 
@@ -75,7 +82,8 @@ int main(int argc, char* argv[]) {
 }
 
 void program_options(int argc, char* argv[], std::string& off_file_points, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence) {
+                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence,
+                     bool& collapse) {
   namespace po = boost::program_options;
   po::options_description hidden("Hidden options");
   hidden.add_options()("input-file", po::value<std::string>(&off_file_points),
@@ -94,7 +102,10 @@ void program_options(int argc, char* argv[], std::string& off_file_points, std::
       "Characteristic p of the coefficient field Z/pZ for computing homology.")(
       "min-persistence,m", po::value<Filtration_value>(&min_persistence),
       "Minimal lifetime of homology feature to be recorded. Default is 0. Enter a negative value to see zero length "
-      "intervals");
+      "intervals")(
+      "collapse-edges,c", po::bool_switch(&collapse),
+      "Remove the dominated edges of the Rips graph before the expansion. The persistence diagram is the same, up to "
+      "intervals of length 0, and it is usually much faster to compute.");
 
   po::positional_options_description pos;
   pos.add("input-file", 1);
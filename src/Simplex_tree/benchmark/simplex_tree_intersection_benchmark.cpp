@@ -0,0 +1,109 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/Simplex_tree/sorted_intersection.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort, std::unique
+#include <random>
+#include <cstdlib>  // for EXIT_SUCCESS, EXIT_FAILURE
+
+using Dictionary = std::vector<std::pair<int, double>>;
+using Dictionary_it = Dictionary::const_iterator;
+
+// Sorted set of size labels, picked among [0;universe)
+Dictionary random_dictionary(std::size_t size, int universe, std::mt19937& gen) {
+  std::uniform_int_distribution<int> label(0, universe - 1);
+  std::vector<int> labels;
+  while (labels.size() < size) {
+    labels.push_back(label(gen));
+    if (labels.size() == size) {
+      std::sort(labels.begin(), labels.end());
+      labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+    }
+  }
+  Dictionary dictionary;
+  for (int l : labels) dictionary.emplace_back(l, 0.);
+  return dictionary;
+}
+
+// The scalar merge formerly used by Simplex_tree::intersection
+struct Merge_intersection {
+  template<class Output>
+  void operator()(Dictionary_it begin1, Dictionary_it end1, Dictionary_it begin2, Dictionary_it end2,
+                  Output output) const {
+    if (begin1 == end1 || begin2 == end2) return;
+    while (true) {
+      if (begin1->first == begin2->first) {
+        output(begin1, begin2);
+        if (++begin1 == end1 || ++begin2 == end2) return;
+      } else if (begin1->first < begin2->first) {
+        if (++begin1 == end1) return;
+      } else {
+        if (++begin2 == end2) return;
+      }
+    }
+  }
+};
+
+struct Sorted_intersection {
+  template<class Output>
+  void operator()(Dictionary_it begin1, Dictionary_it end1, Dictionary_it begin2, Dictionary_it end2,
+                  Output output) const {
+    Gudhi::simplex_tree::sorted_intersection(begin1, end1, begin2, end2, output);
+  }
+};
+
+template<class Intersection>
+double intersections_per_second(const std::vector<Dictionary>& first, const std::vector<Dictionary>& second,
+                                int repetitions, Intersection intersection, std::size_t& checksum) {
+  std::vector<std::pair<int, double>> result;
+  Gudhi::Clock clock;
+  for (int r = 0; r < repetitions; ++r) {
+    for (std::size_t i = 0; i < first.size(); ++i) {
+      result.clear();
+      intersection(first[i].begin(), first[i].end(), second[i].begin(), second[i].end(),
+                   [&](Dictionary_it it1, Dictionary_it it2) {
+                     result.emplace_back(it1->first, (std::max)(it1->second, it2->second));
+                   });
+      checksum += result.size();
+    }
+  }
+  clock.end();
+  return repetitions * first.size() / clock.num_seconds();
+}
+
+int main() {
+  std::mt19937 gen(42);
+  // Sizes of the neighborhoods intersected by the expansion of Rips complexes: balanced ones for uniform samples,
+  // unbalanced ones when a vertex of high degree is involved
+  std::vector<std::pair<std::size_t, std::size_t>> sizes = {{8, 8}, {32, 32}, {128, 128}, {1024, 1024},
+                                                             {8, 256}, {16, 4096}, {256, 8}};
+  const std::size_t num_pairs = 256;
+  std::cout << "size_1 size_2 merge(intersections/s) sorted_intersection(intersections/s)" << std::endl;
+  for (auto size : sizes) {
+    int universe = static_cast<int>(2 * std::max(size.first, size.second));
+    std::vector<Dictionary> first, second;
+    for (std::size_t i = 0; i < num_pairs; ++i) {
+      first.push_back(random_dictionary(size.first, universe, gen));
+      second.push_back(random_dictionary(size.second, universe, gen));
+    }
+    int repetitions = static_cast<int>(1 + (1 << 26) / (num_pairs * (size.first + size.second)));
+    std::size_t merge_checksum = 0, checksum = 0;
+    double merge = intersections_per_second(first, second, repetitions, Merge_intersection(), merge_checksum);
+    double sorted = intersections_per_second(first, second, repetitions, Sorted_intersection(), checksum);
+    if (checksum != merge_checksum) {
+      std::cerr << "Different intersection results for sizes " << size.first << " " << size.second << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << size.first << " " << size.second << " " << merge << " " << sorted << std::endl;
+  }
+  return EXIT_SUCCESS;
+}
@@ -27,5 +27,7 @@ struct SimplexTreeOptions {
   static const bool store_filtration;
   /// If true, the list of vertices present in the complex must always be 0, ..., num_vertices-1, without any hole.
   static constexpr bool contiguous_vertices;
+  /// If true, the sets of siblings of the tree and their members are allocated in an arena owned by the simplex tree. The memory of the removed simplices is only reclaimed when the simplex tree is destroyed or assigned, but the destruction does not traverse the tree. Optional, considered false if it is not declared.
+  static const bool arena_allocated_siblings;
 };
 
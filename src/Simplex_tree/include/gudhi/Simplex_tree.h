@@ -15,6 +15,9 @@
 #include <gudhi/Simplex_tree/Simplex_tree_siblings.h>
 #include <gudhi/Simplex_tree/Simplex_tree_iterators.h>
 #include <gudhi/Simplex_tree/indexing_tag.h>
+#include <gudhi/Simplex_tree/Simplex_tree_arena.h>
+#include <gudhi/Simplex_tree/serialization_utils.h>
+#include <gudhi/Simplex_tree/sorted_intersection.h>
 
 #include <gudhi/reader_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
@@ -27,6 +30,9 @@
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
 #endif
 
 #include <utility>
@@ -35,9 +41,10 @@
 #include <stdexcept>
 #include <limits>  // Inf
 #include <initializer_list>
-#include <algorithm>  // for std::max
-#include <cstdint>  // for std::uint32_t
-#include <iterator>  // for std::distance
+#include <algorithm>  // for std::max, std::merge, std::is_sorted, std::remove
+#include <cstdint>  // for std::uint32_t, std::uint64_t
+#include <iterator>  // for std::distance, std::next, std::prev, std::back_inserter
+#include <memory>  // for std::unique_ptr
 
 namespace Gudhi {
 
@@ -76,11 +83,16 @@ class Simplex_tree {
 
   /* Type of node in the simplex tree. */
   typedef Simplex_tree_node_explicit_storage<Simplex_tree> Node;
+  /* Whether the Siblings are allocated in an arena, false if the options do not declare arena_allocated_siblings. */
+  typedef Simplex_tree_options_arena_allocated_siblings<Options> Arena_allocated_siblings;
   /* Type of dictionary Vertex_handle -> Node for traversing the simplex tree. */
   // Note: this wastes space when Vertex_handle is 32 bits and Node is aligned on 64 bits. It would be better to use a
   // flat_set (with our own comparator) where we can control the layout of the struct (put Vertex_handle and
   // Simplex_key next to each other).
-  typedef typename boost::container::flat_map<Vertex_handle, Node> Dictionary;
+  typedef typename std::conditional<Arena_allocated_siblings::value,
+      boost::container::flat_map<Vertex_handle, Node, std::less<Vertex_handle>,
+                                 Simplex_tree_arena_allocator<std::pair<Vertex_handle, Node>>>,
+      boost::container::flat_map<Vertex_handle, Node>>::type Dictionary;
 
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
@@ -279,12 +291,15 @@ class Simplex_tree {
   /** \brief Constructs an empty simplex tree. */
   Simplex_tree()
       : null_vertex_(-1),
-      root_(nullptr, null_vertex_),
+      arena_(new_arena()),
+      root_(nullptr, null_vertex_, dictionary_allocator()),
       filtration_vect_(),
       dimension_(-1) { }
 
   /** \brief User-defined copy constructor reproduces the whole tree structure. */
-  Simplex_tree(const Simplex_tree& complex_source) {
+  Simplex_tree(const Simplex_tree& complex_source)
+      : arena_(new_arena()),
+      root_(nullptr, -1, dictionary_allocator()) {
 #ifdef DEBUG_TRACES
     std::cout << "Simplex_tree copy constructor" << std::endl;
 #endif  // DEBUG_TRACES
@@ -294,7 +309,8 @@ class Simplex_tree {
   /** \brief User-defined move constructor relocates the whole tree structure.
    *  \exception std::invalid_argument In debug mode, if the complex_source is invalid.
    */
-  Simplex_tree(Simplex_tree && complex_source) {
+  Simplex_tree(Simplex_tree && complex_source)
+      : root_(nullptr, -1, dictionary_allocator()) {
 #ifdef DEBUG_TRACES
     std::cout << "Simplex_tree move constructor" << std::endl;
 #endif  // DEBUG_TRACES
@@ -305,9 +321,13 @@ class Simplex_tree {
     complex_source.dimension_ = -1;
   }
 
-  /** \brief Destructor; deallocates the whole tree structure. */
+  /** \brief Destructor; deallocates the whole tree structure.
+   *
+   * When `SimplexTreeOptions::arena_allocated_siblings` is true, the tree is not traversed, the arena is released. */
   ~Simplex_tree() {
-    root_members_recursive_deletion();
+    if (arena_ == nullptr) {
+      root_members_recursive_deletion();
+    }
   }
 
   /** \brief User-defined copy assignment reproduces the whole tree structure. */
@@ -349,10 +369,13 @@ class Simplex_tree {
     null_vertex_ = complex_source.null_vertex_;
     filtration_vect_.clear();
     dimension_ = complex_source.dimension_;
-    auto root_source = complex_source.root_;
+    // Only read, but rec_copy works on non const Siblings
+    Siblings& root_source = const_cast<Siblings&>(complex_source.root_);
 
     // root members copy
-    root_.members() = Dictionary(boost::container::ordered_unique_range, root_source.members().begin(), root_source.members().end());
+    root_.members() = Dictionary(boost::container::ordered_unique_range, root_source.members().begin(),
+                                 root_source.members().end(), typename Dictionary::key_compare(),
+                                 dictionary_allocator());
     // Needs to reassign children
     for (auto& map_el : root_.members()) {
       map_el.second.assign_children(&root_);
@@ -365,7 +388,7 @@ class Simplex_tree {
     for (auto sh = sib->members().begin(), sh_source = sib_source->members().begin();
          sh != sib->members().end(); ++sh, ++sh_source) {
       if (has_children(sh_source)) {
-        Siblings * newsib = new Siblings(sib, sh_source->first);
+        Siblings * newsib = new_siblings(sib, sh_source->first);
         newsib->members_.reserve(sh_source->second.children()->members().size());
         for (auto & child : sh_source->second.children()->members())
           newsib->members_.emplace_hint(newsib->members_.end(), child.first, Node(newsib, child.second.filtration()));
@@ -378,7 +401,12 @@ class Simplex_tree {
   // Move from complex_source to "this"
   void move_from(Simplex_tree& complex_source) {
     null_vertex_ = std::move(complex_source.null_vertex_);
+    // The members of root_ take the allocator, and thus the arena, of complex_source
     root_ = std::move(complex_source.root_);
+    arena_ = std::move(complex_source.arena_);
+    // complex_source is left empty, but valid
+    complex_source.arena_ = new_arena();
+    complex_source.root_.members() = Dictionary(complex_source.dictionary_allocator());
     filtration_vect_ = std::move(complex_source.filtration_vect_);
     dimension_ = std::move(complex_source.dimension_);
 
@@ -399,6 +427,13 @@ class Simplex_tree {
 
   // delete all root_.members() recursively
   void root_members_recursive_deletion() {
+    if (arena_ != nullptr) {
+      // All the Siblings are released with the arena, root_ needs to be reallocated in the new one
+      std::unique_ptr<Simplex_tree_arena> old_arena = std::move(arena_);
+      arena_ = new_arena();
+      root_.members() = Dictionary(dictionary_allocator());
+      return;
+    }
     for (auto sh = root_.members().begin(); sh != root_.members().end(); ++sh) {
       if (has_children(sh)) {
         rec_delete(sh->second.children());
@@ -409,12 +444,49 @@ class Simplex_tree {
 
   // Recursive deletion
   void rec_delete(Siblings * sib) {
+    // Nothing to do, the memory will be released with the arena
+    if (arena_ != nullptr) return;
     for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
       if (has_children(sh)) {
         rec_delete(sh->second.children());
       }
     }
-    delete sib;
+    delete_siblings(sib);
+  }
+
+  // Returns the arena in which the Siblings are allocated, nullptr if they are allocated with new
+  static std::unique_ptr<Simplex_tree_arena> new_arena() {
+    return std::unique_ptr<Simplex_tree_arena>(Arena_allocated_siblings::value ? new Simplex_tree_arena : nullptr);
+  }
+
+  typename Dictionary::allocator_type dictionary_allocator(std::true_type) const {
+    return typename Dictionary::allocator_type(arena_.get());
+  }
+
+  typename Dictionary::allocator_type dictionary_allocator(std::false_type) const {
+    return typename Dictionary::allocator_type();
+  }
+
+  typename Dictionary::allocator_type dictionary_allocator() const {
+    return dictionary_allocator(Arena_allocated_siblings());
+  }
+
+  // Allocates a new Siblings, in the arena if any
+  template<typename... Args>
+  Siblings* new_siblings(Args&&... args) {
+    if (arena_ == nullptr) {
+      return new Siblings(std::forward<Args>(args)..., dictionary_allocator());
+    }
+    void* memory = arena_->allocate(sizeof(Siblings), alignof(Siblings));
+    return new (memory) Siblings(std::forward<Args>(args)..., dictionary_allocator());
+  }
+
+  void delete_siblings(Siblings* sib) {
+    if (arena_ == nullptr) {
+      delete sib;
+    } else {
+      sib->~Siblings();
+    }
   }
 
  public:
@@ -518,13 +590,13 @@ class Simplex_tree {
 
  public:
   /** \brief returns the number of simplices in the simplex_tree. */
-  size_t num_simplices() {
+  size_t num_simplices() const {
     return num_simplices(&root_);
   }
 
  private:
   /** \brief returns the number of simplices in the simplex_tree. */
-  size_t num_simplices(Siblings * sib) {
+  size_t num_simplices(const Siblings * sib) const {
     auto sib_begin = sib->members().begin();
     auto sib_end = sib->members().end();
     size_t simplices_number = sib_end - sib_begin;
@@ -669,7 +741,7 @@ class Simplex_tree {
       GUDHI_CHECK(*vi != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
       res_insert = curr_sib->members_.emplace(*vi, Node(curr_sib, filtration));
       if (!(has_children(res_insert.first))) {
-        res_insert.first->second.assign_children(new Siblings(curr_sib, *vi));
+        res_insert.first->second.assign_children(new_siblings(curr_sib, *vi));
       }
       curr_sib = res_insert.first->second.children();
     }
@@ -803,13 +875,152 @@ class Simplex_tree {
     if (++first == last) return insertion_result;
     if (!has_children(simplex_one))
       // TODO: have special code here, we know we are building the whole subtree from scratch.
-      simplex_one->second.assign_children(new Siblings(sib, vertex_one));
+      simplex_one->second.assign_children(new_siblings(sib, vertex_one));
     auto res = rec_insert_simplex_and_subfaces_sorted(simplex_one->second.children(), first, last, filt);
     // No need to continue if the full simplex was already there with a low enough filtration value.
     if (res.first != null_simplex()) rec_insert_simplex_and_subfaces_sorted(sib, first, last, filt);
     return res;
   }
 
+ public:
+  /** \brief Inserts a batch of simplices and all their subfaces in the simplicial complex.
+   *
+   * @param[in] simplices Range of simplices, each of them a range of Vertex_handles.
+   * @param[in] filtrations Range of the filtration values of the simplices, in the same order.
+   *
+   * The result is the same as calling `insert_simplex_and_subfaces()` on each simplex: each face gets the minimal
+   * filtration value of the inserted simplices that contain it.
+   *
+   * When the simplex tree is empty, the faces are computed dimension by dimension, from the highest one: the faces
+   * of a dimension are sorted in lexicographic order, in parallel if TBB is available (the sort is skipped if they
+   * already are), duplicates are removed, and only then are their facets added to the faces of the dimension below.
+   * The tree is then built with appends only. Otherwise, when the simplex tree is not empty, the simplices are
+   * inserted one by one with `insert_simplex_and_subfaces()`, as the existing simplices would break the appends.
+   */
+  template<class SimplexRange, class FiltrationRange>
+  void insert_batch_simplices_and_subfaces(const SimplexRange& simplices, const FiltrationRange& filtrations) {
+    auto filtration_it = std::begin(filtrations);
+    if (num_vertices() != 0) {
+      for (auto& simplex : simplices) {
+        GUDHI_CHECK(filtration_it != std::end(filtrations),
+                    std::invalid_argument("Simplex_tree::insert_batch_simplices_and_subfaces - missing filtrations"));
+        insert_simplex_and_subfaces(simplex, *filtration_it);
+        ++filtration_it;
+      }
+      return;
+    }
+
+    // faces[d] stores the faces of dimension d contiguously: face i has the vertices [i*(d+1), (i+1)*(d+1)), in
+    // increasing order, and the filtration value face_filtrations[d][i]
+    std::vector<std::vector<Vertex_handle>> faces;
+    std::vector<std::vector<Filtration_value>> face_filtrations;
+    std::vector<Vertex_handle> simplex_vertices;
+    for (auto& simplex : simplices) {
+      GUDHI_CHECK(filtration_it != std::end(filtrations),
+                  std::invalid_argument("Simplex_tree::insert_batch_simplices_and_subfaces - missing filtrations"));
+      Filtration_value filt = *filtration_it;
+      ++filtration_it;
+      simplex_vertices.assign(std::begin(simplex), std::end(simplex));
+      if (!std::is_sorted(simplex_vertices.begin(), simplex_vertices.end()))
+        std::sort(simplex_vertices.begin(), simplex_vertices.end());
+      simplex_vertices.erase(std::unique(simplex_vertices.begin(), simplex_vertices.end()), simplex_vertices.end());
+      if (simplex_vertices.empty()) continue;
+      GUDHI_CHECK_code(
+        for (Vertex_handle v : simplex_vertices)
+          GUDHI_CHECK(v != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
+      )
+      if (faces.size() < simplex_vertices.size()) {
+        faces.resize(simplex_vertices.size());
+        face_filtrations.resize(simplex_vertices.size());
+      }
+      faces[simplex_vertices.size() - 1].insert(faces[simplex_vertices.size() - 1].end(), simplex_vertices.begin(),
+                                                simplex_vertices.end());
+      face_filtrations[simplex_vertices.size() - 1].push_back(filt);
+    }
+
+    std::vector<std::size_t> order;
+    std::vector<Vertex_handle> unique_faces;
+    std::vector<Filtration_value> unique_filtrations;
+    for (std::size_t face_size = faces.size(); face_size > 0; --face_size) {
+      std::vector<Vertex_handle>& vertices = faces[face_size - 1];
+      std::vector<Filtration_value>& filts = face_filtrations[face_size - 1];
+      // Lexicographic order, and the same faces by increasing filtration values
+      auto is_before = [&](std::size_t face_1, std::size_t face_2) {
+        auto first_1 = vertices.begin() + face_1 * face_size, first_2 = vertices.begin() + face_2 * face_size;
+        auto mismatch = std::mismatch(first_1, first_1 + face_size, first_2);
+        if (mismatch.first != first_1 + face_size) return *mismatch.first < *mismatch.second;
+        return filts[face_1] < filts[face_2];
+      };
+      order.resize(filts.size());
+      for (std::size_t idx = 0; idx < order.size(); ++idx) order[idx] = idx;
+      if (!std::is_sorted(order.begin(), order.end(), is_before)) {
+#ifdef GUDHI_USE_TBB
+        tbb::parallel_sort(order.begin(), order.end(), is_before);
+#else
+        std::sort(order.begin(), order.end(), is_before);
+#endif
+      }
+      // The first occurrence of a face has the minimal filtration value, the following ones are removed
+      unique_faces.clear();
+      unique_filtrations.clear();
+      for (std::size_t face : order) {
+        auto first = vertices.begin() + face * face_size;
+        if (!unique_filtrations.empty() && std::equal(first, first + face_size, unique_faces.end() - face_size))
+          continue;
+        unique_faces.insert(unique_faces.end(), first, first + face_size);
+        unique_filtrations.push_back(filts[face]);
+      }
+      vertices.swap(unique_faces);
+      filts.swap(unique_filtrations);
+      if (face_size == 1) break;
+      // The facets of the unique faces, with the filtration value of their coface
+      std::vector<Vertex_handle>& facets = faces[face_size - 2];
+      std::vector<Filtration_value>& facet_filtrations = face_filtrations[face_size - 2];
+      for (std::size_t face = 0; face < filts.size(); ++face) {
+        auto first = vertices.begin() + face * face_size;
+        for (std::size_t removed = 0; removed < face_size; ++removed) {
+          facets.insert(facets.end(), first, first + removed);
+          facets.insert(facets.end(), first + removed + 1, first + face_size);
+          facet_filtrations.push_back(filts[face]);
+        }
+      }
+    }
+
+    // The faces of each dimension are sorted, so the children of a simplex are contiguous and appended in order
+    std::vector<Vertex_handle> parent_vertices;
+    for (std::size_t face_size = 1; face_size <= faces.size(); ++face_size) {
+      const std::vector<Vertex_handle>& vertices = faces[face_size - 1];
+      Siblings* sib = &root_;
+      for (std::size_t face = 0; face < face_filtrations[face_size - 1].size(); ++face) {
+        auto first = vertices.begin() + face * face_size;
+        // The parent is the facet made of the first vertices, found again only when it changes
+        if (face_size > 1 && (face == 0 || !std::equal(first, first + face_size - 1, first - face_size))) {
+          parent_vertices.assign(first, first + face_size - 1);
+          Simplex_handle parent = find_simplex(parent_vertices);
+          if (!has_children(parent))
+            parent->second.assign_children(new_siblings(parent->second.children(), parent->first));
+          sib = parent->second.children();
+        }
+        sib->members_.emplace_hint(sib->members_.end(), *(first + face_size - 1),
+                                   Node(sib, face_filtrations[face_size - 1][face]));
+      }
+    }
+    dimension_ = static_cast<int>(faces.size()) - 1;
+  }
+
+  /** \brief Inserts a batch of simplices and all their subfaces in the simplicial complex, with filtration value
+   * 0.
+   *
+   * @param[in] simplices Range of simplices, each of them a range of Vertex_handles.
+   *
+   * See the other `insert_batch_simplices_and_subfaces()`.
+   */
+  template<class SimplexRange>
+  void insert_batch_simplices_and_subfaces(const SimplexRange& simplices) {
+    std::vector<Filtration_value> filtrations(std::distance(std::begin(simplices), std::end(simplices)), 0);
+    insert_batch_simplices_and_subfaces(simplices, filtrations);
+  }
+
  public:
   /** \brief Assign a value 'key' to the key of the simplex
    * represented by the Simplex_handle 'sh'. */
@@ -881,6 +1092,68 @@ class Simplex_tree {
 #endif
   }
 
+  /** \brief Updates the filtration after simplices have been inserted or removed, and assigns to each simplex its
+   * index in the filtration as Simplex_key.
+   *
+   * The simplices whose Simplex_key is still their index in the previous filtration keep their relative order, the
+   * other ones (i.e. the ones inserted since the last call) are sorted and merged with them. This costs a traversal of
+   * the tree plus the sort of the new simplices, instead of the sort of all the simplices done by
+   * `initialize_filtration()`. If the previous order is not valid anymore, for instance because filtration values
+   * were modified with `assign_filtration()`, or if the filtration was never initialized, all the simplices are
+   * sorted again.
+   *
+   * The resulting filtration is the same as the one of `initialize_filtration()`. If
+   * SimplexTreeOptions::store_key is false, it is equivalent to `initialize_filtration()`.
+   */
+  void update_filtration() {
+    update_filtration(std::integral_constant<bool, Options::store_key>());
+  }
+
+ private:
+  void update_filtration(std::false_type) {
+    initialize_filtration();
+  }
+
+  void update_filtration(std::true_type) {
+    // The handles of filtration_vect_ may have been invalidated by the modifications, only its size is used.
+    std::size_t old_size = filtration_vect_.size();
+    if (old_size == 0) {
+      initialize_filtration();
+    } else {
+      // Simplices at their previous index, with holes for the removed simplices
+      std::vector<Simplex_handle> old_simplices(old_size, null_simplex());
+      std::vector<Simplex_handle> new_simplices;
+      for (Simplex_handle sh : complex_simplex_range()) {
+        std::size_t idx = static_cast<std::size_t>(key(sh));
+        if (idx < old_size && old_simplices[idx] == null_simplex()) {
+          old_simplices[idx] = sh;
+        } else {
+          new_simplices.push_back(sh);
+        }
+      }
+      old_simplices.erase(std::remove(old_simplices.begin(), old_simplices.end(), null_simplex()),
+                          old_simplices.end());
+
+      if (!std::is_sorted(old_simplices.begin(), old_simplices.end(), is_before_in_filtration(this))) {
+        initialize_filtration();
+      } else {
+#ifdef GUDHI_USE_TBB
+        tbb::parallel_sort(new_simplices.begin(), new_simplices.end(), is_before_in_filtration(this));
+#else
+        std::stable_sort(new_simplices.begin(), new_simplices.end(), is_before_in_filtration(this));
+#endif
+        filtration_vect_.clear();
+        filtration_vect_.reserve(old_simplices.size() + new_simplices.size());
+        std::merge(old_simplices.begin(), old_simplices.end(), new_simplices.begin(), new_simplices.end(),
+                   std::back_inserter(filtration_vect_), is_before_in_filtration(this));
+      }
+    }
+    Simplex_key idx = 0;
+    for (Simplex_handle sh : filtration_vect_) {
+      assign_key(sh, idx++);
+    }
+  }
+
  private:
   /** Recursive search of cofaces
    * This function uses DFS
@@ -1080,7 +1353,7 @@ class Simplex_tree {
       if (v < u) std::swap(u, v);
       auto sh = find_vertex(u);
       if (!has_children(sh)) {
-        sh->second.assign_children(new Siblings(&root_, sh->first));
+        sh->second.assign_children(new_siblings(&root_, sh->first));
       }
 
       sh->second.children()->members().emplace(v,
@@ -1098,25 +1371,45 @@ class Simplex_tree {
    * value of one of its edges.
    *
    * The Simplex_tree must contain no simplex of dimension bigger than
-   * 1 when calling the method. */
+   * 1 when calling the method.
+   *
+   * The subtrees rooted at the different vertices are independent, they are expanded in parallel if TBB is
+   * available. */
   void expansion(int max_dim) {
     if (max_dim <= 1) return;
+    // Lowest value of k reached by siblings_expansion, max_dim if there is no edge
+#ifdef GUDHI_USE_TBB
+    dimension_ = tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, root_.members_.size()), max_dim,
+        [&](const tbb::blocked_range<std::size_t>& range, int lowest_k) {
+          for (std::size_t idx = range.begin(); idx != range.end(); ++idx) {
+            Dictionary_it root_it = root_.members_.begin() + idx;
+            if (has_children(root_it)) {
+              siblings_expansion(root_it->second.children(), max_dim - 1, lowest_k);
+            }
+          }
+          return lowest_k;
+        },
+        [](int lowest_k_1, int lowest_k_2) { return (std::min)(lowest_k_1, lowest_k_2); });
+#else
     dimension_ = max_dim;
     for (Dictionary_it root_it = root_.members_.begin();
          root_it != root_.members_.end(); ++root_it) {
       if (has_children(root_it)) {
-        siblings_expansion(root_it->second.children(), max_dim - 1);
+        siblings_expansion(root_it->second.children(), max_dim - 1, dimension_);
       }
     }
+#endif
     dimension_ = max_dim - dimension_;
   }
 
  private:
-  /** \brief Recursive expansion of the simplex tree.*/
+  /** \brief Recursive expansion of the simplex tree.
+   *
+   * Only modifies the subtree of siblings, so that it can be called concurrently on different subtrees. */
   void siblings_expansion(Siblings * siblings,  // must contain elements
-                          int k) {
-    if (dimension_ > k) {
-      dimension_ = k;
+                          int k, int& lowest_k) {
+    if (lowest_k > k) {
+      lowest_k = k;
     }
     if (k == 0)
       return;
@@ -1139,12 +1432,12 @@ class Simplex_tree {
                      root_sh->second.children()->members().end(),
                      s_h->second.filtration());
         if (inter.size() != 0) {
-          Siblings * new_sib = new Siblings(siblings,  // oncles
+          Siblings * new_sib = new_siblings(siblings,  // oncles
                                             s_h->first,  // parent
                                             inter);  // boost::container::ordered_unique_range_t
           inter.clear();
           s_h->second.assign_children(new_sib);
-          siblings_expansion(new_sib, k - 1);
+          siblings_expansion(new_sib, k - 1, lowest_k);
         } else {
           // ensure the children property
           s_h->second.assign_children(siblings);
@@ -1155,27 +1448,18 @@ class Simplex_tree {
   }
 
   /** \brief Intersects Dictionary 1 [begin1;end1) with Dictionary 2 [begin2,end2)
-   * and assigns the maximal possible Filtration_value to the Nodes. */
+   * and assigns the maximal possible Filtration_value to the Nodes.
+   *
+   * Dictionaries of very different sizes, as the children of a vertex of high degree, are intersected by galloping. */
   static void intersection(std::vector<std::pair<Vertex_handle, Node> >& intersection,
                            Dictionary_it begin1, Dictionary_it end1,
                            Dictionary_it begin2, Dictionary_it end2,
                            Filtration_value filtration_) {
-    if (begin1 == end1 || begin2 == end2)
-      return;  // ----->>
-    while (true) {
-      if (begin1->first == begin2->first) {
-        Filtration_value filt = (std::max)({begin1->second.filtration(), begin2->second.filtration(), filtration_});
-        intersection.emplace_back(begin1->first, Node(nullptr, filt));
-        if (++begin1 == end1 || ++begin2 == end2)
-          return;  // ----->>
-      } else if (begin1->first < begin2->first) {
-        if (++begin1 == end1)
-          return;
-      } else /* begin1->first > begin2->first */ {
-        if (++begin2 == end2)
-          return;  // ----->>
-      }
-    }
+    simplex_tree::sorted_intersection(begin1, end1, begin2, end2,
+        [&](Dictionary_it it1, Dictionary_it it2) {
+          Filtration_value filt = (std::max)({it1->second.filtration(), it2->second.filtration(), filtration_});
+          intersection.emplace_back(it1->first, Node(nullptr, filt));
+        });
   }
 
  public:
@@ -1207,6 +1491,57 @@ class Simplex_tree {
     }
   }
 
+  /** \brief Parallel version of `expansion_with_blockers`.
+   *
+   * @param[in] max_dim Expansion maximal dimension value.
+   * @param[in] block_simplex Blocker oracle. Its concept is <CODE>bool block_simplex(Simplex_handle sh)</CODE>
+   *
+   * The simplices are inserted dimension by dimension: the candidates of a given dimension are only computed once
+   * all the simplices of lower dimension have been vetted by `block_simplex`, and the sets of siblings of a given
+   * dimension are expanded in parallel if TBB is available. The resulting complex is the same as with
+   * `expansion_with_blockers` as long as the result of `block_simplex` only depends on the simplex and its faces.
+   *
+   * @warning `block_simplex` may be called concurrently on different simplices of the same dimension, it must be
+   * thread safe, and must not examine or modify simplices of the same dimension as its argument.
+   */
+  template< typename Blocker >
+  void parallel_expansion_with_blockers(int max_dim, Blocker block_simplex) {
+    // Sets of siblings whose members have the dimension being expanded
+    std::vector<Siblings*> level;
+    for (auto& simplex : root_.members()) {
+      if (has_children(&simplex)) {
+        level.push_back(simplex.second.children());
+      }
+    }
+    if (max_dim >= 1 && !level.empty() && dimension_ < 1) {
+      dimension_ = 1;
+    }
+    for (int dim = 2; dim <= max_dim && !level.empty(); ++dim) {
+      std::vector<std::vector<Siblings*>> next_level(level.size());
+      auto expand = [&](std::size_t idx) {
+        Siblings* siblings = level[idx];
+        for (Dictionary_it simplex = siblings->members().begin(); simplex != siblings->members().end(); ++simplex) {
+          Siblings* new_sib = simplex_expansion_with_blockers(siblings, simplex, block_simplex);
+          if (new_sib != nullptr) {
+            next_level[idx].push_back(new_sib);
+          }
+        }
+      };
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), level.size(), expand);
+#else
+      for (std::size_t idx = 0; idx < level.size(); ++idx) expand(idx);
+#endif
+      level.clear();
+      for (auto& new_sibs : next_level) {
+        level.insert(level.end(), new_sibs.begin(), new_sibs.end());
+      }
+      if (!level.empty() && dimension_ < dim) {
+        dimension_ = dim;
+      }
+    }
+  }
+
  private:
   /** \brief Recursive expansion with blockers of the simplex tree.*/
   template< typename Blocker >
@@ -1221,58 +1556,70 @@ class Simplex_tree {
       return;
     // Reverse loop starting before the last one for 'next' to be the last one
     for (auto simplex = siblings->members().rbegin() + 1; simplex != siblings->members().rend(); simplex++) {
-      std::vector<std::pair<Vertex_handle, Node> > intersection;
-      for(auto next = siblings->members().rbegin(); next != simplex; next++) {
-        bool to_be_inserted = true;
-        Filtration_value filt = simplex->second.filtration();
-        // If all the boundaries are present, 'next' needs to be inserted
-        for (Simplex_handle border : boundary_simplex_range(simplex)) {
-          Simplex_handle border_child = find_child(border, next->first);
-          if (border_child == null_simplex()) {
-            to_be_inserted=false;
-            break;
-          }
-          filt = (std::max)(filt, filtration(border_child));
-        }
-        if (to_be_inserted) {
-          intersection.emplace_back(next->first, Node(nullptr, filt));
-        }
+      Siblings* new_sib = simplex_expansion_with_blockers(siblings, std::prev(simplex.base()), block_simplex);
+      if (new_sib != nullptr) {
+        siblings_expansion_with_blockers(new_sib, max_dim, k - 1, block_simplex);
       }
-      if (intersection.size() != 0) {
-        // Reverse the order to insert
-        Siblings * new_sib = new Siblings(siblings,  // oncles
-                                          simplex->first,  // parent
-                                          boost::adaptors::reverse(intersection));  // boost::container::ordered_unique_range_t
-        std::vector<Vertex_handle> blocked_new_sib_vertex_list;
-        // As all intersections are inserted, we can call the blocker function on all new_sib members
-        for (auto new_sib_member = new_sib->members().begin();
-             new_sib_member != new_sib->members().end();
-             new_sib_member++) {
-           bool blocker_result = block_simplex(new_sib_member);
-           // new_sib member has been blocked by the blocker function
-           // add it to the list to be removed - do not perform it while looping on it
-           if (blocker_result) {
-             blocked_new_sib_vertex_list.push_back(new_sib_member->first);
-           }
-        }
-        if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
-          // Specific case where all have to be deleted
-          delete new_sib;
-          // ensure the children property
-          simplex->second.assign_children(siblings);
-        } else {
-          for (auto& blocked_new_sib_member : blocked_new_sib_vertex_list) {
-            new_sib->members().erase(blocked_new_sib_member);
-          }
-          // ensure recursive call
-          simplex->second.assign_children(new_sib);
-          siblings_expansion_with_blockers(new_sib, max_dim, k - 1, block_simplex);
+    }
+  }
+
+  /** \brief Inserts the cofaces of simplex made of simplex and one of its next siblings whose faces are all in the
+   * complex, and removes the ones blocked by block_simplex.
+   *
+   * Only reads the simplices of lower dimension than the cofaces, and returns the new children of simplex, or
+   * nullptr if there is none. */
+  template< typename Blocker >
+  Siblings* simplex_expansion_with_blockers(Siblings* siblings, Dictionary_it simplex, Blocker& block_simplex) {
+    std::vector<std::pair<Vertex_handle, Node> > intersection;
+    for (auto next = std::next(simplex); next != siblings->members().end(); next++) {
+      bool to_be_inserted = true;
+      Filtration_value filt = simplex->second.filtration();
+      // If all the boundaries are present, 'next' needs to be inserted
+      for (Simplex_handle border : boundary_simplex_range(simplex)) {
+        Simplex_handle border_child = find_child(border, next->first);
+        if (border_child == null_simplex()) {
+          to_be_inserted=false;
+          break;
         }
-      } else {
-        // ensure the children property
-        simplex->second.assign_children(siblings);
+        filt = (std::max)(filt, filtration(border_child));
       }
+      if (to_be_inserted) {
+        intersection.emplace_back(next->first, Node(nullptr, filt));
+      }
+    }
+    if (intersection.size() == 0) {
+      // ensure the children property
+      simplex->second.assign_children(siblings);
+      return nullptr;
     }
+    Siblings * new_sib = new_siblings(siblings,  // oncles
+                                      simplex->first,  // parent
+                                      intersection);  // boost::container::ordered_unique_range_t
+    std::vector<Vertex_handle> blocked_new_sib_vertex_list;
+    // As all intersections are inserted, we can call the blocker function on all new_sib members
+    for (auto new_sib_member = new_sib->members().begin();
+         new_sib_member != new_sib->members().end();
+         new_sib_member++) {
+       bool blocker_result = block_simplex(new_sib_member);
+       // new_sib member has been blocked by the blocker function
+       // add it to the list to be removed - do not perform it while looping on it
+       if (blocker_result) {
+         blocked_new_sib_vertex_list.push_back(new_sib_member->first);
+       }
+    }
+    if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
+      // Specific case where all have to be deleted
+      delete_siblings(new_sib);
+      // ensure the children property
+      simplex->second.assign_children(siblings);
+      return nullptr;
+    }
+    for (auto& blocked_new_sib_member : blocked_new_sib_vertex_list) {
+      new_sib->members().erase(blocked_new_sib_member);
+    }
+    // ensure recursive call
+    simplex->second.assign_children(new_sib);
+    return new_sib;
   }
 
   /* \private Returns the Simplex_handle composed of the vertex list (from the Simplex_handle), plus the given
@@ -1310,6 +1657,117 @@ class Simplex_tree {
     }
   }
 
+ public:
+  /** \brief Returns the size in bytes of the buffer needed by `serialize()`.
+   *
+   * Each siblings set is written as its number of members, followed by the vertices of its members and their
+   * filtration values (if `SimplexTreeOptions::store_filtration` is true), followed by the siblings sets of the
+   * children of its members, in depth-first order (a childless member is written as an empty set). The numbers of
+   * members are written as `std::uint64_t`, as a siblings set can have more members than `Vertex_handle` can count.
+   */
+  std::size_t get_serialization_size() const {
+    const std::size_t vh_byte_size = sizeof(Vertex_handle);
+    const std::size_t fv_byte_size = Options::store_filtration ? sizeof(Filtration_value) : 0;
+    const std::size_t size_byte_size = sizeof(std::uint64_t);
+    // The number of members of root_, then for each simplex its vertex, its filtration and its number of children
+    return size_byte_size + num_simplices() * (vh_byte_size + fv_byte_size + size_byte_size);
+  }
+
+  /** \brief Serializes the simplex tree in a binary buffer, in the machine byte order.
+   *
+   * @param[in] buffer The buffer, of at least `get_serialization_size()` bytes.
+   * @param[in] buffer_size The size of the buffer, must be `get_serialization_size()`.
+   *
+   * @exception std::invalid_argument If buffer_size does not match the serialization size.
+   *
+   * The Simplex_key are not serialized, `initialize_filtration()` must be called again after `deserialize()`.
+   */
+  void serialize(char* buffer, const std::size_t buffer_size) const {
+    if (buffer_size != get_serialization_size())
+      throw std::invalid_argument("Simplex_tree::serialize - buffer size does not match the serialization size");
+    rec_serialize(&root_, buffer);
+  }
+
+  /** \brief Deserializes a buffer written by `serialize()` in this simplex tree, that must be empty.
+   *
+   * @param[in] buffer The buffer, which can for instance be a memory mapped file.
+   * @param[in] buffer_size The size of the buffer.
+   *
+   * @exception std::invalid_argument If the buffer is not a valid serialization.
+   *
+   * The tree is rebuilt in one pass: the members of each siblings set are appended in order, without any search.
+   * The serialization must come from a `Simplex_tree` with the same `Vertex_handle` and `Filtration_value` types,
+   * the same `store_filtration` option, and a machine with the same byte order.
+   */
+  void deserialize(const char* buffer, const std::size_t buffer_size) {
+    GUDHI_CHECK(num_vertices() == 0, std::logic_error("Simplex_tree::deserialize - Simplex_tree must be empty"));
+    const char* end = buffer + buffer_size;
+    std::uint64_t members_size;
+    const char* ptr = read_serialized(members_size, buffer, end);
+    ptr = rec_deserialize(&root_, members_size, ptr, end, 0);
+    if (ptr != end)
+      throw std::invalid_argument("Simplex_tree::deserialize - buffer size does not match the serialization size");
+  }
+
+ private:
+  char* rec_serialize(const Siblings* sib, char* ptr) const {
+    ptr = simplex_tree::serialize_trivial(static_cast<std::uint64_t>(sib->members().size()), ptr);
+    for (auto& map_el : sib->members()) {
+      ptr = simplex_tree::serialize_trivial(map_el.first, ptr);
+      if (Options::store_filtration)
+        ptr = simplex_tree::serialize_trivial(map_el.second.filtration(), ptr);
+    }
+    for (auto& map_el : sib->members()) {
+      if (has_children(&map_el)) {
+        ptr = rec_serialize(map_el.second.children(), ptr);
+      } else {
+        ptr = simplex_tree::serialize_trivial(static_cast<std::uint64_t>(0), ptr);
+      }
+    }
+    return ptr;
+  }
+
+  template<typename T>
+  static const char* read_serialized(T& value, const char* ptr, const char* end) {
+    if (static_cast<std::size_t>(end - ptr) < sizeof(T))
+      throw std::invalid_argument("Simplex_tree::deserialize - unexpected end of buffer");
+    return simplex_tree::deserialize_trivial(value, ptr);
+  }
+
+  // Reads members_size members of sib, then the siblings sets of their children. dim is the dimension of the members.
+  const char* rec_deserialize(Siblings* sib, std::uint64_t members_size, const char* ptr, const char* end, int dim) {
+    if (members_size == 0)
+      return ptr;
+    const std::size_t fv_byte_size = Options::store_filtration ? sizeof(Filtration_value) : 0;
+    if (static_cast<std::uint64_t>(end - ptr) / (sizeof(Vertex_handle) + fv_byte_size) < members_size)
+      throw std::invalid_argument("Simplex_tree::deserialize - unexpected end of buffer");
+    sib->members_.reserve(static_cast<std::size_t>(members_size));
+    Vertex_handle vertex;
+    Filtration_value filtration = 0;
+    for (std::uint64_t idx = 0; idx < members_size; idx++) {
+      ptr = simplex_tree::deserialize_trivial(vertex, ptr);
+      if (Options::store_filtration)
+        ptr = simplex_tree::deserialize_trivial(filtration, ptr);
+      if (!sib->members_.empty() && !(sib->members_.rbegin()->first < vertex))
+        throw std::invalid_argument("Simplex_tree::deserialize - vertices are not sorted");
+      // Default is no children
+      sib->members_.emplace_hint(sib->members_.end(), vertex, Node(sib, filtration));
+    }
+    std::uint64_t child_size;
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      ptr = read_serialized(child_size, ptr, end);
+      if (child_size > 0) {
+        Siblings* child = new_siblings(sib, sh->first);
+        sh->second.assign_children(child);
+        ptr = rec_deserialize(child, child_size, ptr, end, dim + 1);
+      }
+    }
+    if (dim > dimension_) {
+      dimension_ = dim;
+    }
+    return ptr;
+  }
+
  public:
   /** \brief This function ensures that each simplex has a higher filtration value than its faces by increasing the
    * filtration values.
@@ -1390,7 +1848,7 @@ class Simplex_tree {
     if (last == list.begin() && sib != root()) {
       // Removing the whole siblings, parent becomes a leaf.
       sib->oncles()->members()[sib->parent()].assign_children(sib->oncles());
-      delete sib;
+      delete_siblings(sib);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
       return true;
@@ -1459,7 +1917,7 @@ class Simplex_tree {
     } else {
       // Sibling is emptied : must be deleted, and its parent must point on his own Sibling
       child->oncles()->members().at(child->parent()).assign_children(child->oncles());
-      delete child;
+      delete_siblings(child);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
     }
@@ -1467,6 +1925,8 @@ class Simplex_tree {
 
  private:
   Vertex_handle null_vertex_;
+  /** \brief Arena in which the Siblings are allocated, nullptr if they are allocated with new. Must outlive root_.*/
+  std::unique_ptr<Simplex_tree_arena> arena_;
   /** \brief Total number of simplices in the complex, without the empty simplex.*/
   /** \brief Set of simplex tree Nodes representing the vertices.*/
   Siblings root_;
@@ -1524,6 +1984,7 @@ struct Simplex_tree_options_full_featured {
   static const bool store_key = true;
   static const bool store_filtration = true;
   static const bool contiguous_vertices = false;
+  static const bool arena_allocated_siblings = false;
 };
 
 /** Model of SimplexTreeOptions, faster than `Simplex_tree_options_full_featured` but note the unsafe
@@ -1540,6 +2001,7 @@ struct Simplex_tree_options_fast_persistence {
   static const bool store_key = true;
   static const bool store_filtration = true;
   static const bool contiguous_vertices = true;
+  static const bool arena_allocated_siblings = false;
 };
 
 /** @} */  // end defgroup simplex_tree
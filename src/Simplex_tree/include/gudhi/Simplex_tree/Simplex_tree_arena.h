@@ -0,0 +1,174 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_SIMPLEX_TREE_ARENA_H_
+#define SIMPLEX_TREE_SIMPLEX_TREE_ARENA_H_
+
+#include <gudhi/Debug_utils.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+#include <vector>
+#include <cstddef>  // for std::size_t, std::max_align_t
+#include <cstdint>  // for std::uintptr_t
+#include <new>  // for operator new
+#include <type_traits>  // for std::true_type, std::false_type, std::integral_constant
+
+namespace Gudhi {
+
+/* \addtogroup simplex_tree
+ * @{
+ */
+
+/* \brief Whether the Siblings of a Simplex_tree with the given options are allocated in an arena: the value of
+ * `SimplexTreeOptions::arena_allocated_siblings`, or false if the options do not declare it. */
+template<typename Options, typename = void>
+struct Simplex_tree_options_arena_allocated_siblings : std::false_type {};
+
+template<typename Options>
+struct Simplex_tree_options_arena_allocated_siblings<
+    Options, typename std::conditional<true, void, decltype(Options::arena_allocated_siblings)>::type>
+    : std::integral_constant<bool, Options::arena_allocated_siblings> {};
+
+/* \brief Monotonic arena in which the Siblings of a Simplex_tree and their members are allocated.
+ *
+ * Memory is taken from blocks of increasing size and is only given back when the arena is destroyed, except for the
+ * last allocation, so that a flat_map growing at the end of the arena does not waste memory. If TBB is available, the
+ * expansion of the Simplex_tree is parallel, and each thread allocates in its own blocks, without any lock. */
+class Simplex_tree_arena {
+ public:
+  Simplex_tree_arena() {}
+
+  Simplex_tree_arena(const Simplex_tree_arena&) = delete;
+  Simplex_tree_arena& operator=(const Simplex_tree_arena&) = delete;
+
+  ~Simplex_tree_arena() {
+#ifdef GUDHI_USE_TBB
+    for (Blocks& blocks : thread_blocks_)
+      for (char* block : blocks.blocks_) ::operator delete(block);
+#else
+    for (char* block : blocks_.blocks_) ::operator delete(block);
+#endif
+  }
+
+  void* allocate(std::size_t bytes, std::size_t alignment) {
+    GUDHI_CHECK(alignment <= alignof(std::max_align_t), "Simplex_tree_arena - over aligned type");
+    Blocks& blocks = local_blocks();
+    // Large allocations get their own block, not to waste the end of the current one
+    if (bytes > blocks.next_block_size_ / 4) return blocks.new_block(bytes);
+
+    std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(blocks.current_) % alignment) % alignment;
+    if (padding + bytes > blocks.remaining_) {
+      blocks.current_ = blocks.new_block(blocks.next_block_size_);
+      blocks.remaining_ = blocks.next_block_size_;
+      padding = 0;
+      if (blocks.next_block_size_ < max_block_size) blocks.next_block_size_ *= 2;
+    }
+    char* result = blocks.current_ + padding;
+    blocks.current_ = result + bytes;
+    blocks.remaining_ -= padding + bytes;
+    return result;
+  }
+
+  void deallocate(void* pointer, std::size_t bytes) noexcept {
+    Blocks& blocks = local_blocks();
+    // Only the last allocation of the thread can be reused, the rest is released with the arena
+    if (static_cast<char*>(pointer) + bytes == blocks.current_) {
+      blocks.current_ = static_cast<char*>(pointer);
+      blocks.remaining_ += bytes;
+    }
+  }
+
+ private:
+  static const std::size_t initial_block_size = 1 << 14;
+  static const std::size_t max_block_size = 1 << 24;
+
+  // Blocks in which a thread allocates
+  struct Blocks {
+    Blocks() : current_(nullptr), remaining_(0), next_block_size_(initial_block_size) {}
+
+    char* new_block(std::size_t bytes) {
+      blocks_.reserve(blocks_.size() + 1);
+      char* block = static_cast<char*>(::operator new(bytes));
+      blocks_.push_back(block);
+      return block;
+    }
+
+    std::vector<char*> blocks_;
+    char* current_;
+    std::size_t remaining_;
+    std::size_t next_block_size_;
+  };
+
+#ifdef GUDHI_USE_TBB
+  Blocks& local_blocks() { return thread_blocks_.local(); }
+
+  tbb::enumerable_thread_specific<Blocks> thread_blocks_;
+#else
+  Blocks& local_blocks() { return blocks_; }
+
+  Blocks blocks_;
+#endif
+};
+
+/* \brief Allocator of the members of the Siblings of a Simplex_tree, in a Simplex_tree_arena. */
+template<typename T>
+class Simplex_tree_arena_allocator {
+ public:
+  typedef T value_type;
+  // The allocator follows the container, as the arena is owned by the Simplex_tree
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  typedef std::false_type is_always_equal;
+
+  template<typename U>
+  struct rebind {
+    typedef Simplex_tree_arena_allocator<U> other;
+  };
+
+  explicit Simplex_tree_arena_allocator(Simplex_tree_arena* arena) noexcept
+      : arena_(arena) {
+  }
+
+  template<typename U>
+  Simplex_tree_arena_allocator(const Simplex_tree_arena_allocator<U>& other) noexcept
+      : arena_(other.arena()) {
+  }
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, std::size_t n) noexcept {
+    arena_->deallocate(pointer, n * sizeof(T));
+  }
+
+  Simplex_tree_arena* arena() const noexcept {
+    return arena_;
+  }
+
+  template<typename U>
+  bool operator==(const Simplex_tree_arena_allocator<U>& other) const noexcept {
+    return arena_ == other.arena();
+  }
+
+  template<typename U>
+  bool operator!=(const Simplex_tree_arena_allocator<U>& other) const noexcept {
+    return arena_ != other.arena();
+  }
+
+ private:
+  Simplex_tree_arena* arena_;
+};
+
+/* @} */  // end addtogroup simplex_tree
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SIMPLEX_TREE_ARENA_H_
@@ -13,6 +13,13 @@
 
 #include <vector>
 
+// MSVC only applies the empty base optimization to the first base class without this attribute
+#if defined(_MSC_VER)
+#define GUDHI_EMPTY_BASES __declspec(empty_bases)
+#else
+#define GUDHI_EMPTY_BASES
+#endif
+
 namespace Gudhi {
 
 /* \addtogroup simplex_tree
@@ -24,10 +31,11 @@ namespace Gudhi {
  * \brief Node of a simplex tree with filtration value
  * and simplex key.
  *
- * It stores explicitely its own filtration value and its own Simplex_key.
+ * It stores explicitely its own filtration value and its own Simplex_key. When the Simplex_key or the
+ * filtration value is not stored, the corresponding base is empty and takes no space in the node.
  */
 template<class SimplexTree>
-struct Simplex_tree_node_explicit_storage : SimplexTree::Filtration_simplex_base, SimplexTree::Key_simplex_base {
+struct GUDHI_EMPTY_BASES Simplex_tree_node_explicit_storage : SimplexTree::Filtration_simplex_base, SimplexTree::Key_simplex_base {
   typedef typename SimplexTree::Siblings Siblings;
   typedef typename SimplexTree::Filtration_value Filtration_value;
   typedef typename SimplexTree::Simplex_key Simplex_key;
@@ -50,6 +58,10 @@ struct Simplex_tree_node_explicit_storage : SimplexTree::Filtration_simplex_base
     return children_;
   }
 
+  const Siblings * children() const {
+    return children_;
+  }
+
  private:
   Siblings * children_;
 };
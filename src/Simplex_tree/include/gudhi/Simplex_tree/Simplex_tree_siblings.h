@@ -57,6 +57,14 @@ class Simplex_tree_siblings {
         members_() {
   }
 
+  /* Constructor with values, the members are allocated with allocator.*/
+  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent,
+                        const typename Dictionary::allocator_type & allocator)
+      : oncles_(oncles),
+        parent_(parent),
+        members_(allocator) {
+  }
+
   /* \brief Constructor with initialized set of members.
    *
    * 'members' must be sorted and unique.*/
@@ -71,6 +79,21 @@ class Simplex_tree_siblings {
     }
   }
 
+  /* \brief Constructor with initialized set of members, allocated with allocator.
+   *
+   * 'members' must be sorted and unique.*/
+  template<typename RandomAccessVertexRange>
+  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const RandomAccessVertexRange & members,
+                        const typename Dictionary::allocator_type & allocator)
+      : oncles_(oncles),
+        parent_(parent),
+        members_(boost::container::ordered_unique_range, members.begin(), members.end(),
+                 typename Dictionary::key_compare(), allocator) {
+    for (auto& map_el : members_) {
+      map_el.second.assign_children(this);
+    }
+  }
+
   /*
    * \brief Inserts a Node in the set of siblings nodes.
    *
@@ -100,6 +123,10 @@ class Simplex_tree_siblings {
     return members_;
   }
 
+  const Dictionary & members() const {
+    return members_;
+  }
+
   size_t size() const {
     return members_.size();
   }
@@ -0,0 +1,48 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+#define SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+
+#include <cstring>  // for memcpy
+#include <type_traits>  // for std::is_trivially_copyable
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/* \brief Serialize the given value and insert it at start position, in the machine byte order.
+ *
+ * @param[in] value The value to serialize.
+ * @param[in] start Start position where the value is serialized.
+ * @return The new position in the buffer of what was serialized.
+ */
+template<class ArgumentType>
+char* serialize_trivial(ArgumentType value, char* start) {
+  static_assert(std::is_trivially_copyable<ArgumentType>::value, "Only trivially copyable types can be serialized");
+  std::memcpy(start, &value, sizeof(ArgumentType));
+  return start + sizeof(ArgumentType);
+}
+
+/* \brief Deserialize at the start position in an array of char and sets the value with it.
+ *
+ * @param[in] value The value where to deserialize based on its type.
+ * @param[in] start Start position where the value is serialized.
+ * @return The new position in the buffer of what was deserialized.
+ */
+template<class ArgumentType>
+const char* deserialize_trivial(ArgumentType& value, const char* start) {
+  static_assert(std::is_trivially_copyable<ArgumentType>::value, "Only trivially copyable types can be deserialized");
+  std::memcpy(&value, start, sizeof(ArgumentType));
+  return start + sizeof(ArgumentType);
+}
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SERIALIZATION_UTILS_H_
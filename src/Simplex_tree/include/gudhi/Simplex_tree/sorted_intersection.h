@@ -0,0 +1,87 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef SIMPLEX_TREE_SORTED_INTERSECTION_H_
+#define SIMPLEX_TREE_SORTED_INTERSECTION_H_
+
+#include <algorithm>  // for std::lower_bound
+#include <iterator>  // for std::distance
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/* When one range is this many times longer than the other one, the intersection is done by galloping in the longer
+ * range instead of merging both. */
+static const int gallop_size_ratio = 16;
+
+/* \brief Exponential search of the first element with a key not lower than key in [begin;end), end excluded, starting
+ * from begin. Only O(log(d)) keys are read, where d is the distance between begin and the result. */
+template<class RandomAccessIterator, class Key>
+RandomAccessIterator gallop(RandomAccessIterator begin, RandomAccessIterator end, const Key& key) {
+  auto size = std::distance(begin, end);
+  if (size == 0 || !(begin->first < key)) return begin;
+  decltype(size) low = 0;  // begin[low].first < key
+  decltype(size) high = 1;
+  while (high < size && begin[high].first < key) {
+    low = high;
+    high *= 2;
+  }
+  if (high > size) high = size;
+  return std::lower_bound(begin + low + 1, begin + high, key,
+                          [](decltype(*begin) element, const Key& value) { return element.first < value; });
+}
+
+/* Calls output(it1, it2) for each element of the small range with the same key in the large range. */
+template<bool small_is_first, class SmallIterator, class LargeIterator, class Output>
+void gallop_intersection(SmallIterator small_begin, SmallIterator small_end,
+                         LargeIterator large_begin, LargeIterator large_end, Output& output) {
+  for (; small_begin != small_end; ++small_begin) {
+    large_begin = gallop(large_begin, large_end, small_begin->first);
+    if (large_begin == large_end) return;
+    if (large_begin->first == small_begin->first) {
+      if (small_is_first)
+        output(small_begin, large_begin);
+      else
+        output(large_begin, small_begin);
+      ++large_begin;
+    }
+  }
+}
+
+/* \brief Intersects the sorted ranges [begin1;end1) and [begin2;end2) of pairs, with unique keys on first, and calls
+ * output(it1, it2) for each pair of elements with the same key, in increasing key order.
+ *
+ * Balanced ranges are merged without branching on the comparison result, so that the loop does not suffer from branch
+ * mispredictions on random labels. When a range is much shorter than the other one, the elements of the shortest are
+ * searched by galloping in the longest, which reads only a logarithmic number of its keys. */
+template<class RandomAccessIterator1, class RandomAccessIterator2, class Output>
+void sorted_intersection(RandomAccessIterator1 begin1, RandomAccessIterator1 end1,
+                         RandomAccessIterator2 begin2, RandomAccessIterator2 end2, Output output) {
+  auto size1 = std::distance(begin1, end1);
+  auto size2 = std::distance(begin2, end2);
+  if (size1 == 0 || size2 == 0) return;
+  if (size1 * gallop_size_ratio < size2) {
+    gallop_intersection<true>(begin1, end1, begin2, end2, output);
+  } else if (size2 * gallop_size_ratio < size1) {
+    gallop_intersection<false>(begin2, end2, begin1, end1, output);
+  } else {
+    while (begin1 != end1 && begin2 != end2) {
+      auto key1 = begin1->first;
+      auto key2 = begin2->first;
+      if (key1 == key2) output(begin1, begin2);
+      begin1 += (key1 <= key2);
+      begin2 += (key2 <= key1);
+    }
+  }
+}
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SORTED_INTERSECTION_H_
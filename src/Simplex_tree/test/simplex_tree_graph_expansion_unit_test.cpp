@@ -16,6 +16,8 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <functional> // greater
+#include <random>
+#include <vector>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -28,7 +30,12 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocated_siblings = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>> list_of_tested_variants;
 
 
 bool AreAlmostTheSame(float a, float b) {
@@ -243,3 +250,112 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_expansion_2, typeST, list_of_tested_v
   BOOST_CHECK(AreAlmostTheSame(simplex_tree.filtration(simplex_tree.find({1,2,3})), 5.));
   BOOST_CHECK(simplex_tree.find({0,1,2,3}) == simplex_tree.null_simplex());
 }
+
+template<typename typeST>
+void insert_random_graph(typeST& simplex_tree, int num_vertices, double edge_probability) {
+  std::mt19937 gen(42);
+  std::bernoulli_distribution edge(edge_probability);
+  std::uniform_int_distribution<int> filtration(0, 100);
+  for (int u = 0; u < num_vertices; ++u) {
+    simplex_tree.insert_simplex({u}, 0.);
+    for (int v = u + 1; v < num_vertices; ++v) {
+      if (edge(gen)) simplex_tree.insert_simplex({u, v}, filtration(gen));
+    }
+  }
+}
+
+// Inserts all the cliques of the graph until dimension max_dim, one by one with their maximal edge filtration value
+template<typename typeST>
+void insert_cliques(typeST& simplex_tree, int num_vertices, int max_dim) {
+  typeST graph(simplex_tree);
+  for (int dim = 2; dim <= max_dim; ++dim) {
+    std::vector<std::pair<std::vector<int>, double>> cofaces;
+    for (auto sh : simplex_tree.skeleton_simplex_range(dim - 1)) {
+      if (simplex_tree.dimension(sh) != dim - 1) continue;
+      std::vector<int> simplex(simplex_tree.simplex_vertex_range(sh).begin(),
+                               simplex_tree.simplex_vertex_range(sh).end());
+      // Vertices are in decreasing order, simplex[0] is the largest
+      for (int v = simplex[0] + 1; v < num_vertices; ++v) {
+        double filt = simplex_tree.filtration(sh);
+        bool is_clique = true;
+        for (int u : simplex) {
+          auto edge = graph.find({u, v});
+          if (edge == graph.null_simplex()) {
+            is_clique = false;
+            break;
+          }
+          filt = std::max(filt, static_cast<double>(graph.filtration(edge)));
+        }
+        if (is_clique) {
+          simplex.push_back(v);
+          cofaces.emplace_back(simplex, filt);
+          simplex.pop_back();
+        }
+      }
+    }
+    for (auto& coface : cofaces) simplex_tree.insert_simplex(coface.first, coface.second);
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_expansion_random_graph, typeST, list_of_tested_variants) {
+  typeST simplex_tree;
+  insert_random_graph(simplex_tree, 60, 0.4);
+  typeST expected_simplex_tree(simplex_tree);
+  simplex_tree.expansion(4);
+  insert_cliques(expected_simplex_tree, 60, 4);
+
+  std::cout << "simplex_tree_expansion_random_graph - " << simplex_tree.num_simplices() << " simplices - dimension "
+            << simplex_tree.dimension() << std::endl;
+  BOOST_CHECK(simplex_tree.num_simplices() == expected_simplex_tree.num_simplices());
+  BOOST_CHECK(simplex_tree.dimension() == expected_simplex_tree.dimension());
+  BOOST_CHECK(simplex_tree == expected_simplex_tree);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_expansion_hub_graph, typeST, list_of_tested_variants) {
+  // A few vertices connected to all the others, in a sparse graph, make the expansion intersect sets of very
+  // different sizes
+  const int num_vertices = 300;
+  typeST simplex_tree;
+  insert_random_graph(simplex_tree, num_vertices, 0.03);
+  for (int hub : {0, 1, 150}) {
+    for (int v = 0; v < num_vertices; ++v) {
+      if (v != hub) simplex_tree.insert_simplex({hub, v}, hub);
+    }
+  }
+  typeST expected_simplex_tree(simplex_tree);
+  simplex_tree.expansion(4);
+  insert_cliques(expected_simplex_tree, num_vertices, 4);
+
+  std::cout << "simplex_tree_expansion_hub_graph - " << simplex_tree.num_simplices() << " simplices - dimension "
+            << simplex_tree.dimension() << std::endl;
+  BOOST_CHECK(simplex_tree.num_simplices() == expected_simplex_tree.num_simplices());
+  BOOST_CHECK(simplex_tree.dimension() == expected_simplex_tree.dimension());
+  BOOST_CHECK(simplex_tree == expected_simplex_tree);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_parallel_expansion_with_blockers, typeST, list_of_tested_variants) {
+  using Simplex_handle = typename typeST::Simplex_handle;
+  for (int max_dim : {1, 2, 3, 5}) {
+    typeST simplex_tree;
+    insert_random_graph(simplex_tree, 40, 0.5);
+    typeST parallel_simplex_tree(simplex_tree);
+
+    // Only depends on the simplex, and modifies its filtration value
+    auto blocker = [](typeST& stree, Simplex_handle sh) {
+      int sum = 0;
+      for (auto vertex : stree.simplex_vertex_range(sh)) sum += vertex;
+      stree.assign_filtration(sh, stree.filtration(sh) + 1.);
+      return sum % 7 == 0;
+    };
+    simplex_tree.expansion_with_blockers(max_dim, [&](Simplex_handle sh) { return blocker(simplex_tree, sh); });
+    parallel_simplex_tree.parallel_expansion_with_blockers(max_dim, [&](Simplex_handle sh) {
+        return blocker(parallel_simplex_tree, sh);
+      });
+
+    std::cout << "simplex_tree_parallel_expansion_with_blockers - " << parallel_simplex_tree.num_simplices()
+              << " simplices - dimension " << parallel_simplex_tree.dimension() << std::endl;
+    BOOST_CHECK(parallel_simplex_tree.num_simplices() == simplex_tree.num_simplices());
+    BOOST_CHECK(parallel_simplex_tree.dimension() == simplex_tree.dimension());
+    BOOST_CHECK(parallel_simplex_tree == simplex_tree);
+  }
+}
@@ -0,0 +1,133 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <stdexcept>  // for std::invalid_argument
+#include <limits>  // for std::numeric_limits
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "simplex_tree_serialization"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+//  ^
+// /!\ Nothing else from Simplex_tree shall be included to test includes are well defined.
+#include "gudhi/Simplex_tree.h"
+
+using namespace Gudhi;
+
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocated_siblings = true;
+};
+
+struct Simplex_tree_options_minimal : Simplex_tree_options_full_featured {
+  // Not doing persistence, so we don't need those
+  static const bool store_key = false;
+  static const bool store_filtration = false;
+  // I have few vertices
+  typedef short Vertex_handle;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>,
+                         Simplex_tree<Simplex_tree_options_minimal>> list_of_tested_variants;
+
+template<typename Stree>
+void build_complex(Stree& st) {
+  // Filtration values are only allowed if they are stored
+  auto fil = [](double filtration) { return Stree::Options::store_filtration ? filtration : 0.; };
+  st.insert_simplex_and_subfaces({0, 1, 6, 7}, fil(4.));
+  st.insert_simplex_and_subfaces({3, 4, 5}, fil(3.));
+  st.insert_simplex_and_subfaces({3, 0}, fil(2.));
+  st.insert_simplex_and_subfaces({2, 1, 0}, fil(3.));
+  st.insert_simplex_and_subfaces({8}, fil(1.));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_serialization, Stree, list_of_tested_variants) {
+  Stree st;
+  build_complex(st);
+  std::size_t buffer_size = st.get_serialization_size();
+  std::cout << "Serialization of " << st.num_simplices() << " simplices in " << buffer_size << " bytes" << std::endl;
+  std::vector<char> buffer(buffer_size);
+  st.serialize(buffer.data(), buffer_size);
+
+  Stree st_from_buffer;
+  st_from_buffer.deserialize(buffer.data(), buffer_size);
+  BOOST_CHECK(st_from_buffer.num_simplices() == st.num_simplices());
+  BOOST_CHECK(st_from_buffer.dimension() == 3);
+  BOOST_CHECK(st_from_buffer == st);
+
+  // Through a file
+  {
+    std::ofstream ofs("simplex_tree_serialization.bin", std::ios::binary);
+    ofs.write(buffer.data(), buffer_size);
+  }
+  std::ifstream ifs("simplex_tree_serialization.bin", std::ios::binary);
+  std::vector<char> file_buffer(buffer_size);
+  ifs.read(file_buffer.data(), buffer_size);
+  Stree st_from_file;
+  st_from_file.deserialize(file_buffer.data(), buffer_size);
+  BOOST_CHECK(st_from_file == st);
+
+  // Through a const reference, serialization does not modify the tree
+  const Stree& const_st = st;
+  BOOST_CHECK(const_st.get_serialization_size() == buffer_size);
+  BOOST_CHECK(const_st.num_simplices() == st_from_buffer.num_simplices());
+  std::vector<char> const_buffer(buffer_size);
+  const_st.serialize(const_buffer.data(), buffer_size);
+  BOOST_CHECK(const_buffer == buffer);
+
+  // An empty simplex tree
+  Stree empty_st;
+  std::vector<char> empty_buffer(empty_st.get_serialization_size());
+  empty_st.serialize(empty_buffer.data(), empty_buffer.size());
+  Stree empty_st_from_buffer;
+  empty_st_from_buffer.deserialize(empty_buffer.data(), empty_buffer.size());
+  BOOST_CHECK(empty_st_from_buffer.num_simplices() == 0);
+  BOOST_CHECK(empty_st_from_buffer == empty_st);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_serialization_exceptions, Stree, list_of_tested_variants) {
+  Stree st;
+  build_complex(st);
+  std::size_t buffer_size = st.get_serialization_size();
+  std::vector<char> buffer(buffer_size + 1);
+  BOOST_CHECK_THROW(st.serialize(buffer.data(), buffer_size + 1), std::invalid_argument);
+  st.serialize(buffer.data(), buffer_size);
+
+  Stree st_too_long;
+  BOOST_CHECK_THROW(st_too_long.deserialize(buffer.data(), buffer_size + 1), std::invalid_argument);
+  Stree st_too_short;
+  BOOST_CHECK_THROW(st_too_short.deserialize(buffer.data(), buffer_size - 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(simplex_tree_serialization_full_range_vertex_handle) {
+  // The root has more members than a short can count
+  using Stree = Simplex_tree<Simplex_tree_options_minimal>;
+  using Vertex_handle = Stree::Vertex_handle;
+  Stree st;
+  for (int vertex = std::numeric_limits<Vertex_handle>::min(); vertex <= std::numeric_limits<Vertex_handle>::max();
+       ++vertex) {
+    if (vertex != st.null_vertex())
+      st.insert_simplex({static_cast<Vertex_handle>(vertex)});
+  }
+  st.insert_simplex_and_subfaces({std::numeric_limits<Vertex_handle>::min(), 0,
+                                  std::numeric_limits<Vertex_handle>::max()});
+  BOOST_CHECK(st.num_vertices() == 65535);
+
+  std::size_t buffer_size = st.get_serialization_size();
+  std::vector<char> buffer(buffer_size);
+  st.serialize(buffer.data(), buffer_size);
+  Stree st_from_buffer;
+  st_from_buffer.deserialize(buffer.data(), buffer_size);
+  BOOST_CHECK(st_from_buffer.num_vertices() == 65535);
+  BOOST_CHECK(st_from_buffer.num_simplices() == st.num_simplices());
+  BOOST_CHECK(st_from_buffer.dimension() == 2);
+  BOOST_CHECK(st_from_buffer == st);
+}
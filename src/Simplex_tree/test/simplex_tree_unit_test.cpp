@@ -17,6 +17,7 @@
 #include <limits>
 #include <functional>  // greater
 #include <tuple>  // std::tie
+#include <random>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -29,7 +30,12 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocated_siblings = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>> list_of_tested_variants;
 
 
 template<class typeST>
@@ -988,3 +994,164 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(insert_duplicated_vertices, typeST, list_of_tested
   BOOST_CHECK(st.num_simplices() == st.num_vertices() + 1);
 
 }
+
+struct Options_without_key_nor_filtration : Simplex_tree_options_full_featured {
+  static const bool store_key = false;
+  static const bool store_filtration = false;
+};
+
+BOOST_AUTO_TEST_CASE(simplex_tree_node_without_key_nor_filtration) {
+  using Node = typename Simplex_tree<Options_without_key_nor_filtration>::Node;
+  using Siblings = typename Simplex_tree<Options_without_key_nor_filtration>::Siblings;
+  // Only the pointer to the children remains
+  BOOST_CHECK(sizeof(Node) == sizeof(Siblings*));
+}
+
+BOOST_AUTO_TEST_CASE(arena_allocated_siblings_prune_and_remove) {
+  using Arena_simplex_tree = Simplex_tree<Simplex_tree_options_arena>;
+  Arena_simplex_tree st;
+  Simplex_tree<> expected_st;
+  for (int i = 0; i < 20; ++i) {
+    st.insert_simplex_and_subfaces({i, i + 1, i + 2, i + 3}, i);
+    expected_st.insert_simplex_and_subfaces({i, i + 1, i + 2, i + 3}, i);
+  }
+  BOOST_CHECK(st.num_simplices() == expected_st.num_simplices());
+
+  st.prune_above_filtration(10.);
+  expected_st.prune_above_filtration(10.);
+  st.remove_maximal_simplex(st.find({0, 1, 2, 3}));
+  expected_st.remove_maximal_simplex(expected_st.find({0, 1, 2, 3}));
+  std::cout << "arena_allocated_siblings_prune_and_remove - num_simplices = " << st.num_simplices() << std::endl;
+  BOOST_CHECK(st.num_simplices() == expected_st.num_simplices());
+  BOOST_CHECK(st.find({0, 1, 2, 3}) == st.null_simplex());
+  BOOST_CHECK(st.find({10, 11, 12, 13}) != st.null_simplex());
+  BOOST_CHECK(st.find({11, 12, 13, 14}) == st.null_simplex());
+
+  // Copy, then reuse a moved from and an assigned simplex tree
+  Arena_simplex_tree st_copy(st);
+  BOOST_CHECK(st_copy == st);
+  Arena_simplex_tree st_move(std::move(st));
+  BOOST_CHECK(st_move == st_copy);
+  BOOST_CHECK(st.num_simplices() == 0);
+  st.insert_simplex_and_subfaces({0, 1, 2});
+  BOOST_CHECK(st.num_simplices() == 7);
+  st_copy = st;
+  BOOST_CHECK(st_copy == st);
+  st = std::move(st_move);
+  BOOST_CHECK(st.num_simplices() == expected_st.num_simplices());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_update_filtration, typeST, list_of_tested_variants) {
+  typeST st;
+  // Same simplices, with the filtration computed from scratch
+  auto check_filtration = [](typeST& stree) {
+    typeST expected_stree(stree);
+    expected_stree.initialize_filtration();
+    auto& filtration = stree.filtration_simplex_range();
+    auto& expected_filtration = expected_stree.filtration_simplex_range();
+    BOOST_CHECK(filtration.size() == expected_filtration.size());
+    typename typeST::Simplex_key idx = 0;
+    for (auto sh = filtration.begin(), expected_sh = expected_filtration.begin(); sh != filtration.end();
+         ++sh, ++expected_sh, ++idx) {
+      BOOST_CHECK(stree.key(*sh) == idx);
+      BOOST_CHECK(stree.filtration(*sh) == expected_stree.filtration(*expected_sh));
+      std::vector<typename typeST::Vertex_handle> simplex(stree.simplex_vertex_range(*sh).begin(),
+                                                          stree.simplex_vertex_range(*sh).end());
+      std::vector<typename typeST::Vertex_handle> expected_simplex(
+          expected_stree.simplex_vertex_range(*expected_sh).begin(),
+          expected_stree.simplex_vertex_range(*expected_sh).end());
+      BOOST_CHECK(simplex == expected_simplex);
+    }
+  };
+
+  for (int i = 0; i < 10; ++i) st.insert_simplex_and_subfaces({i, i + 1, i + 2}, i % 3);
+  st.update_filtration();
+  check_filtration(st);
+
+  // New simplices are merged, vertices stay contiguous for Simplex_tree_options_fast_persistence
+  for (int i = 0; i < 10; ++i) st.insert_simplex_and_subfaces({i, i + 3}, i % 4 + 0.5);
+  st.insert_simplex_and_subfaces({9, 10, 11, 12}, 1.);
+  st.update_filtration();
+  check_filtration(st);
+
+  // Removed simplices leave holes
+  st.remove_maximal_simplex(st.find({9, 10, 11, 12}));
+  st.remove_maximal_simplex(st.find({0, 3}));
+  st.insert_simplex_and_subfaces({12, 13}, 0.);
+  st.update_filtration();
+  check_filtration(st);
+
+  // Modified filtration values
+  st.assign_filtration(st.find({12, 13}), 5.);
+  st.assign_filtration(st.find({0, 1, 2}), 4.);
+  st.update_filtration();
+  check_filtration(st);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_insert_batch, typeST, list_of_tested_variants) {
+  // Unsorted vertices, repeated vertices, duplicated simplices and shared faces with different filtration values
+  std::vector<std::vector<int>> simplices = {{3, 1, 2}, {0, 1}, {4, 5, 6, 7}, {2, 1, 3}, {5, 4, 4}, {0, 2, 6},
+                                             {8}, {7, 6, 5, 4, 3}, {1, 2}};
+  std::vector<double> filtrations = {2., 4., 1., 1.5, 0.5, 3., 0., 5., 0.25};
+  typeST st;
+  st.insert_batch_simplices_and_subfaces(simplices, filtrations);
+  typeST expected_st;
+  for (std::size_t idx = 0; idx < simplices.size(); ++idx)
+    expected_st.insert_simplex_and_subfaces(simplices[idx], filtrations[idx]);
+  std::cout << "simplex_tree_insert_batch - num_simplices = " << st.num_simplices() << " - dimension = "
+            << st.dimension() << std::endl;
+  BOOST_CHECK(st.num_simplices() == expected_st.num_simplices());
+  BOOST_CHECK(st.dimension() == 4);
+  BOOST_CHECK(st == expected_st);
+
+  // In a non empty simplex tree, the simplices are inserted one by one, and lower filtration values are kept
+  std::vector<std::vector<int>> other_simplices = {{8, 9}, {0, 1, 2, 3}, {6, 5}, {9, 8}};
+  std::vector<double> other_filtrations = {6., 0.75, 2., 1.};
+  st.insert_batch_simplices_and_subfaces(other_simplices, other_filtrations);
+  for (std::size_t idx = 0; idx < other_simplices.size(); ++idx)
+    expected_st.insert_simplex_and_subfaces(other_simplices[idx], other_filtrations[idx]);
+  BOOST_CHECK(st == expected_st);
+  if (typeST::Options::store_filtration) {
+    BOOST_CHECK(st.filtration(st.find({8, 9})) == 1.);
+    BOOST_CHECK(st.filtration(st.find({5, 6})) == 1.);
+  }
+
+  // Already sorted simplices, the sorts are skipped
+  std::vector<std::vector<int>> sorted_simplices;
+  for (auto sh : expected_st.complex_simplex_range()) {
+    std::vector<int> simplex;
+    for (auto vertex : expected_st.simplex_vertex_range(sh)) simplex.insert(simplex.begin(), vertex);
+    sorted_simplices.push_back(simplex);
+  }
+  std::sort(sorted_simplices.begin(), sorted_simplices.end());
+  std::vector<double> sorted_filtrations;
+  for (auto& simplex : sorted_simplices) sorted_filtrations.push_back(expected_st.filtration(expected_st.find(simplex)));
+  typeST sorted_st;
+  sorted_st.insert_batch_simplices_and_subfaces(sorted_simplices, sorted_filtrations);
+  BOOST_CHECK(sorted_st == expected_st);
+
+  // Many shared faces
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> vertex(0, 15);
+  std::uniform_int_distribution<int> size(1, 6);
+  std::uniform_int_distribution<int> filtration(0, 10);
+  std::vector<std::vector<int>> random_simplices(300);
+  std::vector<double> random_filtrations;
+  typeST expected_random_st;
+  for (auto& simplex : random_simplices) {
+    for (int idx = size(gen); idx > 0; --idx) simplex.push_back(vertex(gen));
+    random_filtrations.push_back(filtration(gen) / 2.);
+    expected_random_st.insert_simplex_and_subfaces(simplex, random_filtrations.back());
+  }
+  typeST random_st;
+  random_st.insert_batch_simplices_and_subfaces(random_simplices, random_filtrations);
+  BOOST_CHECK(random_st.num_simplices() == expected_random_st.num_simplices());
+  BOOST_CHECK(random_st.dimension() == expected_random_st.dimension());
+  BOOST_CHECK(random_st == expected_random_st);
+
+  typeST empty_st;
+  empty_st.insert_batch_simplices_and_subfaces(std::vector<std::vector<int>>());
+  BOOST_CHECK(empty_st.num_simplices() == 0);
+  typeST expected_empty_st;
+  BOOST_CHECK(empty_st == expected_empty_st);
+}
@@ -9,6 +9,7 @@
  */
 
 #include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/Kd_tree_proximity_graph.h>
 #include <gudhi/distance_functions.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Clock.h>
@@ -22,6 +23,7 @@
 #include <limits>  // for numeric limits
 #include <fstream>
 #include <cassert>
+#include <cstdlib>  // for std::atof
 
 
 std::ofstream results_csv("results.csv");
@@ -100,9 +102,34 @@ void benchmark_proximity_graph(const std::string& msg, const std::string& off_fi
   std::cout << "    benchmark_proximity_graph - nb simplices = " << complex.num_simplices() << std::endl;
 }
 
+void benchmark_gudhi_proximity_graph(const std::string& off_file_name, double threshold) {
+  Gudhi::Points_off_reader<std::vector<double>> off_reader(off_file_name);
+  assert(off_reader.is_valid());
+  using Proximity_graph = Gudhi::Proximity_graph<Gudhi::Simplex_tree<>>;
+
+  std::cout << "+ Gudhi::compute_proximity_graph with threshold " << threshold << std::endl;
+  Gudhi::Clock tiled_clock("    benchmark_proximity_graph - tiled distance matrix");
+  Proximity_graph tiled_graph = Gudhi::compute_proximity_graph<Gudhi::Simplex_tree<>>(off_reader.get_point_cloud(),
+                                                                                     threshold,
+                                                                                     Gudhi::Euclidean_distance());
+  tiled_clock.end();
+  std::cout << tiled_clock;
+
+  Gudhi::Clock kd_tree_clock("    benchmark_proximity_graph - kd-tree");
+  Proximity_graph kd_tree_graph = Gudhi::compute_kd_tree_proximity_graph<Gudhi::Simplex_tree<>>(
+      off_reader.get_point_cloud(), threshold);
+  kd_tree_clock.end();
+  std::cout << kd_tree_clock;
+  std::cout << "    benchmark_proximity_graph - nb edges = " << boost::num_edges(tiled_graph) << " - "
+            << boost::num_edges(kd_tree_graph) << std::endl;
+}
+
 int main(int argc, char * const argv[]) {
   std::string off_file_name(argv[1]);
 
+  benchmark_gudhi_proximity_graph(off_file_name, std::numeric_limits<double>::infinity());
+  if (argc > 2) benchmark_gudhi_proximity_graph(off_file_name, std::atof(argv[2]));
+
   // The fastest, the less memory used
   using vecSdirectedS = boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS,
                                               boost::property<Gudhi::vertex_filtration_t, double>,
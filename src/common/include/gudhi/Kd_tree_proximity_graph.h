@@ -0,0 +1,245 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#ifndef KD_TREE_PROXIMITY_GRAPH_H_
+#define KD_TREE_PROXIMITY_GRAPH_H_
+
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/Debug_utils.h>
+
+#include <boost/graph/adjacency_list.hpp>
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::nth_element, std::sort, std::min, std::max
+#include <iterator>  // for std::begin, std::end, std::distance
+#include <type_traits>  // for std::decay
+#include <cmath>  // for std::sqrt
+#include <tuple>  // for std::tie
+
+namespace Gudhi {
+
+namespace detail {
+
+/* Static kd-tree on a set of points, for range queries with the Euclidean distance.
+ * The nodes are split at the median of the coordinate of largest spread, and the points of a leaf are stored
+ * contiguously. */
+template<typename NT>
+class Kd_tree_for_proximity {
+ public:
+  template<typename ForwardPointRange>
+  explicit Kd_tree_for_proximity(const ForwardPointRange& points)
+      : num_points_(std::distance(std::begin(points), std::end(points))),
+        dimension_(num_points_ == 0 ? 0 : std::distance(std::begin(*std::begin(points)),
+                                                        std::end(*std::begin(points)))),
+        coordinates_(num_points_ * dimension_),
+        index_(num_points_) {
+    std::size_t idx = 0;
+    for (auto& point : points) {
+      std::size_t k = 0;
+      for (auto& coordinate : point) {
+        GUDHI_CHECK(k < dimension_, "inconsistent point dimensions");
+        coordinates_[idx * dimension_ + k] = coordinate;
+        ++k;
+      }
+      GUDHI_CHECK(k == dimension_, "inconsistent point dimensions");
+      index_[idx] = idx;
+      ++idx;
+    }
+    if (num_points_ > 0) build(0, num_points_);
+    leaf_coordinates_.resize(num_points_ * dimension_);
+    for (std::size_t pos = 0; pos < num_points_; ++pos)
+      std::copy(point(index_[pos]), point(index_[pos]) + dimension_, leaf_coordinates_.begin() + pos * dimension_);
+  }
+
+  std::size_t num_points() const { return num_points_; }
+
+  /* Appends to neighbors the points of index larger than idx_u, at distance smaller or equal to threshold, with
+   * their distance, sorted by index. */
+  template<typename Filtration_value>
+  void neighbors_after(std::size_t idx_u, Filtration_value threshold,
+                       std::vector<std::pair<std::size_t, Filtration_value>>& neighbors,
+                       std::vector<std::size_t>& stack) const {
+    if (nodes_.empty()) return;
+    std::size_t first = neighbors.size();
+    const NT* query = point(idx_u);
+    stack.clear();
+    stack.push_back(0);
+    while (!stack.empty()) {
+      const Node& node = nodes_[stack.back()];
+      stack.pop_back();
+      if (node.split_dimension == leaf) {
+        for (std::size_t pos = node.begin; pos < node.end; ++pos) {
+          if (index_[pos] <= idx_u) continue;
+          // Same computation as Gudhi::Euclidean_distance
+          const NT* other = leaf_coordinates_.data() + pos * dimension_;
+          NT dist = 0;
+          for (std::size_t k = 0; k < dimension_; ++k) {
+            NT tmp = query[k] - other[k];
+            dist += tmp * tmp;
+          }
+          using std::sqrt;
+          Filtration_value fil = sqrt(dist);
+          if (fil <= threshold) neighbors.emplace_back(index_[pos], fil);
+        }
+      } else {
+        // The difference of coordinates is a lower bound of the distance to all the points of a child.
+        NT coordinate = query[node.split_dimension];
+        Filtration_value gap_right = node.split_value - coordinate;
+        Filtration_value gap_left = coordinate - node.split_value;
+        if (!(gap_right > threshold)) stack.push_back(node.right);
+        if (!(gap_left > threshold)) stack.push_back(node.left);
+      }
+    }
+    std::sort(neighbors.begin() + first, neighbors.end());
+  }
+
+ private:
+  static const std::size_t leaf = static_cast<std::size_t>(-1);
+  static const std::size_t max_leaf_size = 16;
+
+  struct Node {
+    std::size_t begin;
+    std::size_t end;
+    std::size_t split_dimension;
+    NT split_value;
+    std::size_t left;
+    std::size_t right;
+  };
+
+  const NT* point(std::size_t idx) const { return coordinates_.data() + idx * dimension_; }
+
+  std::size_t build(std::size_t begin, std::size_t end) {
+    std::size_t node_idx = nodes_.size();
+    nodes_.push_back(Node{begin, end, leaf, NT(0), 0, 0});
+    if (end - begin <= max_leaf_size) return node_idx;
+
+    std::size_t split_dimension = 0;
+    NT max_spread = 0;
+    for (std::size_t k = 0; k < dimension_; ++k) {
+      NT min_coordinate = point(index_[begin])[k];
+      NT max_coordinate = min_coordinate;
+      for (std::size_t pos = begin + 1; pos < end; ++pos) {
+        min_coordinate = std::min(min_coordinate, point(index_[pos])[k]);
+        max_coordinate = std::max(max_coordinate, point(index_[pos])[k]);
+      }
+      if (max_coordinate - min_coordinate > max_spread) {
+        max_spread = max_coordinate - min_coordinate;
+        split_dimension = k;
+      }
+    }
+    // All the points are identical
+    if (!(max_spread > 0)) return node_idx;
+
+    std::size_t middle = begin + (end - begin) / 2;
+    std::nth_element(index_.begin() + begin, index_.begin() + middle, index_.begin() + end,
+                     [&](std::size_t i, std::size_t j) {
+                       return point(i)[split_dimension] < point(j)[split_dimension];
+                     });
+    NT split_value = point(index_[middle])[split_dimension];
+    std::size_t left = build(begin, middle);
+    std::size_t right = build(middle, end);
+    Node& node = nodes_[node_idx];
+    node.split_dimension = split_dimension;
+    node.split_value = split_value;
+    node.left = left;
+    node.right = right;
+    return node_idx;
+  }
+
+  std::size_t num_points_;
+  std::size_t dimension_;
+  // coordinates_[i * dimension_ + k] is the k-th coordinate of the i-th point
+  std::vector<NT> coordinates_;
+  // Points in the order of the leaves of the tree
+  std::vector<std::size_t> index_;
+  std::vector<NT> leaf_coordinates_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace detail
+
+/** \brief Computes the edges of the proximity graph of the points for the Euclidean distance, with a kd-tree.
+ *
+ * The result is the same as the one of `Gudhi::compute_proximity_edges` with `Gudhi::Euclidean_distance`, but only
+ * the pairs of points that are close to each other are considered, instead of all of them. It is much faster on low
+ * dimensional points when threshold is small compared to the diameter of the point cloud, and slower otherwise.
+ * The range queries are done in parallel if TBB is available. As for `Gudhi::compute_proximity_edges`, the
+ * filtration values may differ from `Gudhi::Euclidean_distance` in the last bits if the compiler contracts floating
+ * point operations.
+ *
+ * \tparam ForwardPointRange furnishes `.begin()` and `.end()` methods. Its points must be ranges of Cartesian
+ * coordinates, of the same dimension.
+ *
+ * @return The number of points.
+ */
+template< typename Vertex_handle
+          , typename Filtration_value
+          , typename ForwardPointRange >
+std::size_t compute_kd_tree_proximity_edges(const ForwardPointRange& points, Filtration_value threshold,
+                                            std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                            std::vector<Filtration_value>& edges_fil) {
+  using Point = typename std::decay<decltype(*std::begin(points))>::type;
+  using NT = typename std::decay<decltype(*std::begin(std::declval<const Point&>()))>::type;
+
+  detail::Kd_tree_for_proximity<NT> kd_tree(points);
+  detail::compute_edges_by_blocks_of_rows(kd_tree.num_points(),
+      [&](std::size_t begin_row, std::size_t end_row, std::vector<std::pair<Vertex_handle, Vertex_handle>>& block,
+          std::vector<Filtration_value>& block_fil) {
+        std::vector<std::pair<std::size_t, Filtration_value>> neighbors;
+        std::vector<std::size_t> stack;
+        for (std::size_t idx_u = begin_row; idx_u < end_row; ++idx_u) {
+          neighbors.clear();
+          kd_tree.neighbors_after(idx_u, threshold, neighbors, stack);
+          for (auto& neighbor : neighbors) {
+            block.emplace_back(idx_u, neighbor.first);
+            block_fil.push_back(neighbor.second);
+          }
+        }
+      }, edges, edges_fil);
+  return kd_tree.num_points();
+}
+
+/** \brief Computes the proximity graph of the points for the Euclidean distance, with a kd-tree.
+ *
+ * The result is the same as the one of `Gudhi::compute_proximity_graph` with `Gudhi::Euclidean_distance`, but the
+ * edges are computed with `Gudhi::compute_kd_tree_proximity_edges`.
+ *
+ * \tparam ForwardPointRange furnishes `.begin()` and `.end()` methods. Its points must be ranges of Cartesian
+ * coordinates, of the same dimension.
+ */
+template< typename SimplicialComplexForProximityGraph
+          , typename ForwardPointRange >
+Proximity_graph<SimplicialComplexForProximityGraph> compute_kd_tree_proximity_graph(
+    const ForwardPointRange& points,
+    typename SimplicialComplexForProximityGraph::Filtration_value threshold) {
+  using Vertex_handle = typename SimplicialComplexForProximityGraph::Vertex_handle;
+  using Filtration_value = typename SimplicialComplexForProximityGraph::Filtration_value;
+
+  std::vector<std::pair< Vertex_handle, Vertex_handle >> edges;
+  std::vector< Filtration_value > edges_fil;
+
+  std::size_t num_points = compute_kd_tree_proximity_edges(points, threshold, edges, edges_fil);
+
+  // Points are labeled from 0 to num_points-1
+  Proximity_graph<SimplicialComplexForProximityGraph> skel_graph(edges.begin(), edges.end(), edges_fil.begin(),
+                                                                 num_points);
+
+  auto vertex_prop = boost::get(vertex_filtration_t(), skel_graph);
+
+  typename boost::graph_traits<Proximity_graph<SimplicialComplexForProximityGraph>>::vertex_iterator vi, vi_end;
+  for (std::tie(vi, vi_end) = boost::vertices(skel_graph);
+       vi != vi_end; ++vi) {
+    boost::put(vertex_prop, *vi, 0.);
+  }
+
+  return skel_graph;
+}
+
+}  // namespace Gudhi
+
+#endif  // KD_TREE_PROXIMITY_GRAPH_H_
@@ -11,15 +11,28 @@
 #ifndef GRAPH_SIMPLICIAL_COMPLEX_H_
 #define GRAPH_SIMPLICIAL_COMPLEX_H_
 
+#include <gudhi/Debug_utils.h>
+
 #include <boost/graph/adjacency_list.hpp>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <utility>  // for pair<>
 #include <vector>
 #include <map>
 #include <tuple>  // for std::tie
+#include <algorithm>  // for std::min, std::max, std::fill
+#include <iterator>  // for std::begin, std::end, std::distance
+#include <type_traits>  // for std::decay, std::true_type, std::false_type
+#include <cmath>  // for std::sqrt
+#include <limits>  // for std::numeric_limits
 
 namespace Gudhi {
 
+class Euclidean_distance;
+
 /* Edge tag for Boost PropertyGraph. */
 struct edge_filtration_t {
   typedef boost::edge_property_tag kind;
@@ -41,15 +54,218 @@ using Proximity_graph = typename boost::adjacency_list < boost::vecS, boost::vec
 , boost::property < vertex_filtration_t, typename SimplicialComplexForProximityGraph::Filtration_value >
 , boost::property < edge_filtration_t, typename SimplicialComplexForProximityGraph::Filtration_value >>;
 
-/** \brief Computes the proximity graph of the points.
+namespace detail {
+
+// Number of consecutive points (rows of the distance matrix) computed by a task.
+const std::size_t proximity_rows_per_block = 64;
+// Number of points whose coordinates are loaded together when computing Euclidean distances.
+const std::size_t proximity_columns_per_tile = 256;
+
+/* Calls compute_block(begin_row, end_row, edges, edges_fil) on blocks of rows, in parallel with TBB, and concatenates
+ * the edges of the blocks in the order of the rows, so that the result does not depend on the scheduling. */
+template<typename Vertex_handle, typename Filtration_value, typename ComputeBlock>
+void compute_edges_by_blocks_of_rows(std::size_t num_points, ComputeBlock compute_block,
+                                     std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                     std::vector<Filtration_value>& edges_fil) {
+  std::size_t num_blocks = (num_points + proximity_rows_per_block - 1) / proximity_rows_per_block;
+  std::vector<std::vector<std::pair<Vertex_handle, Vertex_handle>>> block_edges(num_blocks);
+  std::vector<std::vector<Filtration_value>> block_edges_fil(num_blocks);
+  auto compute = [&](std::size_t block) {
+    std::size_t begin_row = block * proximity_rows_per_block;
+    std::size_t end_row = std::min(begin_row + proximity_rows_per_block, num_points);
+    compute_block(begin_row, end_row, block_edges[block], block_edges_fil[block]);
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(std::size_t(0), num_blocks, compute);
+#else
+  for (std::size_t block = 0; block < num_blocks; ++block) compute(block);
+#endif
+
+  std::size_t num_edges = 0;
+  for (auto& block : block_edges) num_edges += block.size();
+  edges.reserve(edges.size() + num_edges);
+  edges_fil.reserve(edges_fil.size() + num_edges);
+  for (std::size_t block = 0; block < num_blocks; ++block) {
+    edges.insert(edges.end(), block_edges[block].begin(), block_edges[block].end());
+    edges_fil.insert(edges_fil.end(), block_edges_fil[block].begin(), block_edges_fil[block].end());
+    std::vector<std::pair<Vertex_handle, Vertex_handle>>().swap(block_edges[block]);
+    std::vector<Filtration_value>().swap(block_edges_fil[block]);
+  }
+}
+
+template<typename Vertex_handle, typename Filtration_value, typename ForwardPointRange, typename Distance>
+std::size_t compute_proximity_edges_with_distance(const ForwardPointRange& points, Filtration_value threshold,
+                                                  Distance& distance,
+                                                  std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                                  std::vector<Filtration_value>& edges_fil) {
+  auto first = std::begin(points);
+  std::size_t num_points = std::distance(first, std::end(points));
+  compute_edges_by_blocks_of_rows(num_points,
+      [&](std::size_t begin_row, std::size_t end_row, std::vector<std::pair<Vertex_handle, Vertex_handle>>& block,
+          std::vector<Filtration_value>& block_fil) {
+        for (std::size_t idx_u = begin_row; idx_u < end_row; ++idx_u) {
+          auto it_u = first + idx_u;
+          std::size_t idx_v = idx_u + 1;
+          for (auto it_v = it_u + 1; it_v != std::end(points); ++it_v, ++idx_v) {
+            Filtration_value fil = distance(*it_u, *it_v);
+            if (fil <= threshold) {
+              block.emplace_back(idx_u, idx_v);
+              block_fil.push_back(fil);
+            }
+          }
+        }
+      }, edges, edges_fil);
+  return num_points;
+}
+
+/* Euclidean distances, computed from the floating point coordinates of the points stored contiguously, coordinate
+ * by coordinate, so that the inner loops are vectorized. The squared distances are summed in the same order as in
+ * Gudhi::Euclidean_distance, the filtration values are thus the same without floating point contraction. */
+template<typename Vertex_handle, typename Filtration_value, typename ForwardPointRange, typename Distance>
+std::size_t compute_euclidean_proximity_edges(const ForwardPointRange& points, Filtration_value threshold,
+                                              Distance,
+                                              std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                              std::vector<Filtration_value>& edges_fil, std::true_type) {
+  using Point = typename std::decay<decltype(*std::begin(points))>::type;
+  using NT = typename std::decay<decltype(*std::begin(std::declval<const Point&>()))>::type;
+
+  std::size_t num_points = std::distance(std::begin(points), std::end(points));
+  std::size_t dimension = num_points == 0 ? 0 : std::distance(std::begin(*std::begin(points)),
+                                                              std::end(*std::begin(points)));
+  // coordinates[k * num_columns + i] is the k-th coordinate of the i-th point. Points are padded up to a multiple of
+  // the tile size, so that the loops on the tiles have a constant number of iterations.
+  const std::size_t tile_size = proximity_columns_per_tile;
+  std::size_t num_columns = (num_points + tile_size - 1) / tile_size * tile_size;
+  std::vector<NT> coordinates(dimension * num_columns);
+  std::size_t idx = 0;
+  for (auto& point : points) {
+    std::size_t k = 0;
+    for (auto& coordinate : point) {
+      GUDHI_CHECK(k < dimension, "inconsistent point dimensions");
+      coordinates[k * num_columns + idx] = coordinate;
+      ++k;
+    }
+    GUDHI_CHECK(k == dimension, "inconsistent point dimensions");
+    ++idx;
+  }
+
+  // Upper bound on the squared distances, with some margin for rounding errors, to avoid most square roots.
+  NT epsilon = std::max<NT>(std::numeric_limits<NT>::epsilon(), std::numeric_limits<Filtration_value>::epsilon());
+  NT squared_threshold = static_cast<NT>(threshold) * static_cast<NT>(threshold) * (1 + 8 * epsilon);
+
+  compute_edges_by_blocks_of_rows(num_points,
+      [&](std::size_t begin_row, std::size_t end_row, std::vector<std::pair<Vertex_handle, Vertex_handle>>& block,
+          std::vector<Filtration_value>& block_fil) {
+        // Edges of each row of the block, the tiles of columns are the outer loop to keep them in cache.
+        std::vector<std::vector<std::pair<Vertex_handle, Filtration_value>>> row_edges(end_row - begin_row);
+        for (std::size_t begin_column = (begin_row + 1) / tile_size * tile_size; begin_column < num_points;
+             begin_column += tile_size) {
+          std::size_t end_column = std::min(begin_column + tile_size, num_points);
+          for (std::size_t idx_u = begin_row; idx_u < end_row && idx_u + 1 < end_column; ++idx_u) {
+            // Local array, that the compiler knows is not aliased with the coordinates
+            NT dist[proximity_columns_per_tile] = {};
+            for (std::size_t k = 0; k < dimension; ++k) {
+              const NT* column = coordinates.data() + k * num_columns + begin_column;
+              NT coordinate_u = coordinates[k * num_columns + idx_u];
+              for (std::size_t j = 0; j < tile_size; ++j) {
+                NT tmp = coordinate_u - column[j];
+                dist[j] += tmp * tmp;
+              }
+            }
+            auto& row = row_edges[idx_u - begin_row];
+            for (std::size_t idx_v = std::max(begin_column, idx_u + 1); idx_v < end_column; ++idx_v) {
+              NT squared_distance = dist[idx_v - begin_column];
+              if (squared_distance <= squared_threshold) {
+                using std::sqrt;
+                Filtration_value fil = sqrt(squared_distance);
+                if (fil <= threshold) row.emplace_back(idx_v, fil);
+              }
+            }
+          }
+        }
+        for (std::size_t idx_u = begin_row; idx_u < end_row; ++idx_u) {
+          for (auto& edge : row_edges[idx_u - begin_row]) {
+            block.emplace_back(idx_u, edge.first);
+            block_fil.push_back(edge.second);
+          }
+        }
+      }, edges, edges_fil);
+  return num_points;
+}
+
+// Points that are not ranges of floating point coordinates, like std::pair or integer coordinates, whose squared
+// threshold would be rounded in the coordinate type.
+template<typename Vertex_handle, typename Filtration_value, typename ForwardPointRange, typename Distance>
+std::size_t compute_euclidean_proximity_edges(const ForwardPointRange& points, Filtration_value threshold,
+                                              Distance distance,
+                                              std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                              std::vector<Filtration_value>& edges_fil, std::false_type) {
+  return compute_proximity_edges_with_distance(points, threshold, distance, edges, edges_fil);
+}
+
+template<typename Point, typename = void>
+struct Is_floating_point_coordinate_range : std::false_type {};
+
+template<typename Point>
+struct Is_floating_point_coordinate_range<Point, decltype(void(std::begin(std::declval<const Point&>())))>
+    : std::is_floating_point<typename std::decay<decltype(*std::begin(std::declval<const Point&>()))>::type> {};
+
+}  // namespace detail
+
+/** \brief Computes the edges of the proximity graph of the points.
  *
  * If points contains n elements, the proximity graph is the graph with n vertices, and an edge [u,v] iff the
  * distance function between points u and v is smaller than threshold.
  *
- * \tparam ForwardPointRange furnishes `.begin()` and `.end()` methods.
+ * The rows of the distance matrix are computed by blocks, in parallel if TBB is available, and the edges are appended
+ * to edges and edges_fil in lexicographic order. When distance is `Gudhi::Euclidean_distance` and the points are
+ * ranges of floating point coordinates, the coordinates are first copied in a contiguous array, so that the distances
+ * from a point to a tile of points are vectorized. The squared differences are summed in the same order as in
+ * `Gudhi::Euclidean_distance`, the filtration values are thus identical to it, unless the compiler contracts
+ * floating point operations (e.g. into fused multiply-adds with GCC `-ffp-contract=fast`, the default in GNU mode
+ * on targets with FMA), in which case they may differ in the last bits.
+ *
+ * \tparam ForwardPointRange furnishes `.begin()` and `.end()` methods, that return random access iterators.
  *
  * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
- * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+ * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`. It is called concurrently
+ * from several threads if GUDHI is built with TBB, and must thus be thread safe.
+ *
+ * @return The number of points.
+ */
+template< typename Vertex_handle
+          , typename Filtration_value
+          , typename ForwardPointRange
+          , typename Distance >
+std::size_t compute_proximity_edges(const ForwardPointRange& points, Filtration_value threshold, Distance distance,
+                                    std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                    std::vector<Filtration_value>& edges_fil) {
+  return detail::compute_proximity_edges_with_distance(points, threshold, distance, edges, edges_fil);
+}
+
+template< typename Vertex_handle
+          , typename Filtration_value
+          , typename ForwardPointRange >
+std::size_t compute_proximity_edges(const ForwardPointRange& points, Filtration_value threshold,
+                                    const Euclidean_distance& distance,
+                                    std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                    std::vector<Filtration_value>& edges_fil) {
+  using Point = typename std::decay<decltype(*std::begin(points))>::type;
+  return detail::compute_euclidean_proximity_edges(points, threshold, distance, edges, edges_fil,
+                                                   detail::Is_floating_point_coordinate_range<Point>());
+}
+
+/** \brief Computes the proximity graph of the points.
+ *
+ * If points contains n elements, the proximity graph is the graph with n vertices, and an edge [u,v] iff the
+ * distance function between points u and v is smaller than threshold. The edges are computed with
+ * `Gudhi::compute_proximity_edges`, in parallel if TBB is available.
+ *
+ * \tparam ForwardPointRange furnishes `.begin()` and `.end()` methods, that return random access iterators.
+ *
+ * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+ * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`. It is called concurrently
+ * from several threads if GUDHI is built with TBB, and must thus be thread safe.
  */
 template< typename SimplicialComplexForProximityGraph
           , typename ForwardPointRange
@@ -63,25 +279,12 @@ Proximity_graph<SimplicialComplexForProximityGraph> compute_proximity_graph(
 
   std::vector<std::pair< Vertex_handle, Vertex_handle >> edges;
   std::vector< Filtration_value > edges_fil;
-  std::map< Vertex_handle, Filtration_value > vertices;
-
-  Vertex_handle idx_u, idx_v;
-  Filtration_value fil;
-  idx_u = 0;
-  for (auto it_u = points.begin(); it_u != points.end(); ++it_u) {
-    idx_v = idx_u + 1;
-    for (auto it_v = it_u + 1; it_v != points.end(); ++it_v, ++idx_v) {
-      fil = distance(*it_u, *it_v);
-      if (fil <= threshold) {
-        edges.emplace_back(idx_u, idx_v);
-        edges_fil.push_back(fil);
-      }
-    }
-    ++idx_u;
-  }
 
-  // Points are labeled from 0 to idx_u-1
-  Proximity_graph<SimplicialComplexForProximityGraph> skel_graph(edges.begin(), edges.end(), edges_fil.begin(), idx_u);
+  std::size_t num_points = compute_proximity_edges(points, threshold, distance, edges, edges_fil);
+
+  // Points are labeled from 0 to num_points-1
+  Proximity_graph<SimplicialComplexForProximityGraph> skel_graph(edges.begin(), edges.end(), edges_fil.begin(),
+                                                                 num_points);
 
   auto vertex_prop = boost::get(vertex_filtration_t(), skel_graph);
 
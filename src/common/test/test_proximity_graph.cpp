@@ -0,0 +1,174 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2026 Inria
+ */
+
+#include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/Kd_tree_proximity_graph.h>
+#include <gudhi/distance_functions.h>
+
+#include <iostream>
+#include <limits>
+#include <random>
+#include <utility>  // for std::pair
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "proximity_graph"
+#include <boost/test/unit_test.hpp>
+
+using Point = std::vector<double>;
+using Edges = std::vector<std::pair<int, int>>;
+using Edges_filtration = std::vector<double>;
+
+// Naive computation of the proximity graph, with all the pairs of points in lexicographic order.
+template<typename PointRange, typename Distance>
+void naive_proximity_edges(const PointRange& points, double threshold, Distance distance, Edges& edges,
+                           Edges_filtration& edges_fil) {
+  for (std::size_t u = 0; u < points.size(); ++u) {
+    for (std::size_t v = u + 1; v < points.size(); ++v) {
+      double fil = distance(points[u], points[v]);
+      if (fil <= threshold) {
+        edges.emplace_back(u, v);
+        edges_fil.push_back(fil);
+      }
+    }
+  }
+}
+
+std::vector<Point> random_points(std::size_t num_points, std::size_t dimension, std::mt19937& gen) {
+  // Coordinates on a coarse grid, so that some points and some distances are equal. The squared distances are then
+  // exact, and the filtration values can be compared exactly whatever the floating point contraction.
+  std::uniform_int_distribution<int> coordinate(0, 20);
+  std::vector<Point> points(num_points, Point(dimension));
+  for (auto& point : points)
+    for (auto& x : point) x = coordinate(gen) / 4.;
+  return points;
+}
+
+BOOST_AUTO_TEST_CASE( proximity_edges_euclidean )
+{
+  std::mt19937 gen(7);
+  for (std::size_t dimension : {1, 2, 3, 7}) {
+    for (std::size_t num_points : {0, 1, 2, 70, 600}) {
+      std::vector<Point> points = random_points(num_points, dimension, gen);
+      for (double threshold : {0., 0.5, 2., std::numeric_limits<double>::infinity()}) {
+        Edges expected_edges;
+        Edges_filtration expected_fil;
+        naive_proximity_edges(points, threshold, Gudhi::Euclidean_distance(), expected_edges, expected_fil);
+        std::cout << "dimension=" << dimension << " - " << num_points << " points - threshold=" << threshold
+            << " - " << expected_edges.size() << " edges" << std::endl;
+
+        Edges edges;
+        Edges_filtration edges_fil;
+        BOOST_CHECK(Gudhi::compute_proximity_edges(points, threshold, Gudhi::Euclidean_distance(), edges, edges_fil)
+                    == num_points);
+        BOOST_CHECK(edges == expected_edges);
+        BOOST_CHECK(edges_fil == expected_fil);
+
+        Edges kd_tree_edges;
+        Edges_filtration kd_tree_edges_fil;
+        BOOST_CHECK(Gudhi::compute_kd_tree_proximity_edges(points, threshold, kd_tree_edges, kd_tree_edges_fil)
+                    == num_points);
+        BOOST_CHECK(kd_tree_edges == expected_edges);
+        BOOST_CHECK(kd_tree_edges_fil == expected_fil);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( proximity_edges_other_distances )
+{
+  std::mt19937 gen(11);
+  std::vector<Point> points = random_points(300, 3, gen);
+  auto manhattan = [](const Point& p, const Point& q) {
+    double dist = 0.;
+    for (std::size_t k = 0; k < p.size(); ++k) dist += std::abs(p[k] - q[k]);
+    return dist;
+  };
+  Edges expected_edges;
+  Edges_filtration expected_fil;
+  naive_proximity_edges(points, 3., manhattan, expected_edges, expected_fil);
+  Edges edges;
+  Edges_filtration edges_fil;
+  Gudhi::compute_proximity_edges(points, 3., manhattan, edges, edges_fil);
+  BOOST_CHECK(edges == expected_edges);
+  BOOST_CHECK(edges_fil == expected_fil);
+
+  // Points that are not ranges of coordinates
+  std::vector<std::pair<double, double>> pairs;
+  for (auto& point : points) pairs.emplace_back(point[0], point[1]);
+  Edges expected_pair_edges;
+  Edges_filtration expected_pair_fil;
+  naive_proximity_edges(pairs, 1., Gudhi::Euclidean_distance(), expected_pair_edges, expected_pair_fil);
+  Edges pair_edges;
+  Edges_filtration pair_edges_fil;
+  Gudhi::compute_proximity_edges(pairs, 1., Gudhi::Euclidean_distance(), pair_edges, pair_edges_fil);
+  BOOST_CHECK(pair_edges == expected_pair_edges);
+  BOOST_CHECK(pair_edges_fil == expected_pair_fil);
+}
+
+BOOST_AUTO_TEST_CASE( proximity_edges_integer_coordinates )
+{
+  // The threshold must not be rounded to the integer coordinate type
+  using Integer_point = std::vector<int>;
+  std::vector<Integer_point> points = {{0, 0}, {1, 2}, {10, 10}};
+  Edges edges;
+  Edges_filtration edges_fil;
+  BOOST_CHECK(Gudhi::compute_proximity_edges(points, 2.5, Gudhi::Euclidean_distance(), edges, edges_fil) == 3);
+  BOOST_CHECK(edges == Edges({{0, 1}}));
+  BOOST_CHECK(edges_fil == Edges_filtration({Gudhi::Euclidean_distance()(points[0], points[1])}));
+
+  // Same result as Gudhi::Euclidean_distance on all the pairs
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> coordinate(-10, 10);
+  std::vector<Integer_point> random_points(300, Integer_point(3));
+  for (auto& point : random_points)
+    for (auto& x : point) x = coordinate(gen);
+  for (double threshold : {0., 2.5, 4.9, 7.}) {
+    Edges expected_edges;
+    Edges_filtration expected_fil;
+    naive_proximity_edges(random_points, threshold, Gudhi::Euclidean_distance(), expected_edges, expected_fil);
+    Edges random_edges;
+    Edges_filtration random_edges_fil;
+    Gudhi::compute_proximity_edges(random_points, threshold, Gudhi::Euclidean_distance(), random_edges,
+                                   random_edges_fil);
+    std::cout << "integer coordinates - threshold=" << threshold << " - " << expected_edges.size() << " edges"
+              << std::endl;
+    BOOST_CHECK(random_edges == expected_edges);
+    BOOST_CHECK(random_edges_fil == expected_fil);
+  }
+}
+
+struct Simplicial_complex_for_proximity_graph {
+  using Vertex_handle = int;
+  using Filtration_value = float;
+};
+
+BOOST_AUTO_TEST_CASE( proximity_graph_float_filtration )
+{
+  std::mt19937 gen(3);
+  std::vector<Point> points = random_points(200, 2, gen);
+  auto graph = Gudhi::compute_proximity_graph<Simplicial_complex_for_proximity_graph>(points, 1.5f,
+                                                                                      Gudhi::Euclidean_distance());
+  auto kd_tree_graph = Gudhi::compute_kd_tree_proximity_graph<Simplicial_complex_for_proximity_graph>(points, 1.5f);
+  BOOST_CHECK(boost::num_vertices(graph) == 200);
+  BOOST_CHECK(boost::num_vertices(kd_tree_graph) == 200);
+  BOOST_CHECK(boost::num_edges(graph) == boost::num_edges(kd_tree_graph));
+
+  auto edge_prop = boost::get(Gudhi::edge_filtration_t(), graph);
+  auto kd_tree_edge_prop = boost::get(Gudhi::edge_filtration_t(), kd_tree_graph);
+  auto edge_range = boost::edges(graph);
+  auto kd_tree_edge_range = boost::edges(kd_tree_graph);
+  std::size_t num_edges = 0;
+  for (auto ei = edge_range.first, kd_ei = kd_tree_edge_range.first; ei != edge_range.second; ++ei, ++kd_ei) {
+    BOOST_CHECK(boost::source(*ei, graph) == boost::source(*kd_ei, kd_tree_graph));
+    BOOST_CHECK(boost::target(*ei, graph) == boost::target(*kd_ei, kd_tree_graph));
+    BOOST_CHECK(boost::get(edge_prop, *ei) == boost::get(kd_tree_edge_prop, *kd_ei));
+    BOOST_CHECK(boost::get(edge_prop, *ei) <= 1.5f);
+    ++num_edges;
+  }
+  std::cout << num_edges << " edges" << std::endl;
+}
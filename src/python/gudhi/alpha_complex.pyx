@@ -25,11 +25,11 @@ __license__ = "GPL v3"
 
 cdef extern from "Alpha_complex_interface.h" namespace "Gudhi":
     cdef cppclass Alpha_complex_interface "Gudhi::alpha_complex::Alpha_complex_interface":
-        Alpha_complex_interface(vector[vector[double]] points)
+        Alpha_complex_interface(vector[vector[double]] points) nogil
         # bool from_file is a workaround for cython to find the correct signature
-        Alpha_complex_interface(string off_file, bool from_file)
+        Alpha_complex_interface(string off_file, bool from_file) nogil
         vector[double] get_point(int vertex)
-        void create_simplex_tree(Simplex_tree_interface_full_featured* simplex_tree, double max_alpha_square)
+        void create_simplex_tree(Simplex_tree_interface_full_featured* simplex_tree, double max_alpha_square) nogil
 
 # AlphaComplex python interface
 cdef class AlphaComplex:
@@ -68,16 +68,21 @@ cdef class AlphaComplex:
 
     # The real cython constructor
     def __cinit__(self, points=None, off_file=''):
+        cdef string coff_file
+        cdef vector[vector[double]] cpoints
         if off_file is not '':
             if os.path.isfile(off_file):
-                self.thisptr = new Alpha_complex_interface(str.encode(off_file), True)
+                coff_file = str.encode(off_file)
+                with nogil:
+                    self.thisptr = new Alpha_complex_interface(coff_file, True)
             else:
                 print("file " + off_file + " not found.")
         else:
-            if points is None:
-                # Empty Alpha construction
-                points=[]
-            self.thisptr = new Alpha_complex_interface(points)
+            if points is not None:
+                cpoints = points
+            # else empty Alpha construction
+            with nogil:
+                self.thisptr = new Alpha_complex_interface(cpoints)
                 
 
     def __dealloc__(self):
@@ -112,5 +117,8 @@ cdef class AlphaComplex:
         """
         stree = SimplexTree()
         cdef intptr_t stree_int_ptr=stree.thisptr
-        self.thisptr.create_simplex_tree(<Simplex_tree_interface_full_featured*>stree_int_ptr, max_alpha_square)
+        cdef double cmax_alpha_square = max_alpha_square
+        with nogil:
+            self.thisptr.create_simplex_tree(<Simplex_tree_interface_full_featured*>stree_int_ptr,
+                                             cmax_alpha_square)
         return stree
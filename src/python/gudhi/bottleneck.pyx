@@ -2,6 +2,7 @@ from cython cimport numeric
 from libcpp.vector cimport vector
 from libcpp.utility cimport pair
 import os
+from numpy import array as np_array
 
 """ This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
     See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
@@ -18,8 +19,11 @@ __copyright__ = "Copyright (C) 2016 Inria"
 __license__ = "GPL v3"
 
 cdef extern from "Bottleneck_distance_interface.h" namespace "Gudhi::persistence_diagram":
-    double bottleneck(vector[pair[double, double]], vector[pair[double, double]], double)
-    double bottleneck(vector[pair[double, double]], vector[pair[double, double]])
+    double bottleneck(vector[pair[double, double]], vector[pair[double, double]], double) nogil
+    double bottleneck(vector[pair[double, double]], vector[pair[double, double]]) nogil
+    vector[vector[double]] bottleneck_matrix(vector[vector[pair[double, double]]], double) nogil
+    vector[vector[double]] bottleneck_matrix(vector[vector[pair[double, double]]]) nogil
+    double wasserstein(vector[pair[double, double]], vector[pair[double, double]], double, double) nogil
 
 def bottleneck_distance(diagram_1, diagram_2, e=None):
     """This function returns the point corresponding to a given vertex.
@@ -41,9 +45,75 @@ def bottleneck_distance(diagram_1, diagram_2, e=None):
     :rtype: float
     :returns: the bottleneck distance.
     """
+    cdef vector[pair[double, double]] cdiagram_1 = diagram_1
+    cdef vector[pair[double, double]] cdiagram_2 = diagram_2
+    cdef double ce
+    cdef double result
     if e is None:
         # Default value is the smallest double value (not 0, 0 is for exact version)
-        return bottleneck(diagram_1, diagram_2)
+        with nogil:
+            result = bottleneck(cdiagram_1, cdiagram_2)
     else:
         # Can be 0 for exact version
-        return bottleneck(diagram_1, diagram_2, e)
+        ce = e
+        with nogil:
+            result = bottleneck(cdiagram_1, cdiagram_2, ce)
+    return result
+
+
+def bottleneck_distance_matrix(diagrams, e=None):
+    """This function returns the bottleneck distances between all the pairs
+    of a list of persistence diagrams. Each diagram is preprocessed only once,
+    and the pairs are processed in parallel if TBB is available.
+
+    :param diagrams: The persistence diagrams.
+    :type diagrams: list of vector[pair[double, double]]
+    :param e: The approximation parameter, as for
+        :func:`bottleneck_distance()<gudhi.bottleneck_distance>`.
+    :type e: float
+    :rtype: numpy array of dimension 2
+    :returns: the symmetric matrix of the bottleneck distances.
+    """
+    cdef vector[vector[pair[double, double]]] cdiagrams = diagrams
+    cdef double ce
+    cdef vector[vector[double]] result
+    if e is None:
+        with nogil:
+            result = bottleneck_matrix(cdiagrams)
+    else:
+        ce = e
+        with nogil:
+            result = bottleneck_matrix(cdiagrams, ce)
+    return np_array(result)
+
+
+def wasserstein_distance(diagram_1, diagram_2, order=1., delta=0.01):
+    """This function returns the Wasserstein distance of a given order
+    between two persistence diagrams, where the lengths of the edges of the
+    matching are measured with the infinity norm, as for the bottleneck
+    distance. It is computed by an auction algorithm.
+
+    :param diagram_1: The first diagram.
+    :type diagram_1: vector[pair[double, double]]
+    :param diagram_2: The second diagram.
+    :type diagram_2: vector[pair[double, double]]
+    :param order: The order of the Wasserstein distance, at least 1.
+    :type order: float
+    :param delta: The relative error allowed on the distance, greater than 0.
+    :type delta: float
+    :rtype: float
+    :returns: the Wasserstein distance, infinite if the diagrams do not have
+        the same number of infinite points.
+    """
+    if order < 1.:
+        raise ValueError("order must be at least 1")
+    if delta <= 0.:
+        raise ValueError("delta must be positive")
+    cdef vector[pair[double, double]] cdiagram_1 = diagram_1
+    cdef vector[pair[double, double]] cdiagram_2 = diagram_2
+    cdef double corder = order
+    cdef double cdelta = delta
+    cdef double result
+    with nogil:
+        result = wasserstein(cdiagram_1, cdiagram_2, corder, cdelta)
+    return result
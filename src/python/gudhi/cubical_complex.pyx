@@ -6,6 +6,8 @@ from libcpp cimport bool
 import os
 
 from numpy import array as np_array
+from numpy import asarray as np_asarray
+from numpy import prod as np_prod
 
 """ This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
     See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
@@ -24,14 +26,15 @@ __license__ = "MIT"
 cdef extern from "Cubical_complex_interface.h" namespace "Gudhi":
     cdef cppclass Bitmap_cubical_complex_base_interface "Gudhi::Cubical_complex::Cubical_complex_interface<>":
         Bitmap_cubical_complex_base_interface(vector[unsigned] dimensions, vector[double] top_dimensional_cells)
+        Bitmap_cubical_complex_base_interface(vector[unsigned] dimensions, const double* top_dimensional_cells) nogil
         Bitmap_cubical_complex_base_interface(string perseus_file)
         int num_simplices()
         int dimension()
 
 cdef extern from "Persistent_cohomology_interface.h" namespace "Gudhi":
     cdef cppclass Cubical_complex_persistence_interface "Gudhi::Persistent_cohomology_interface<Gudhi::Cubical_complex::Cubical_complex_interface<>>":
-        Cubical_complex_persistence_interface(Bitmap_cubical_complex_base_interface * st, bool persistence_dim_max)
-        vector[pair[int, pair[double, double]]] get_persistence(int homology_coeff_field, double min_persistence)
+        Cubical_complex_persistence_interface(Bitmap_cubical_complex_base_interface * st, bool persistence_dim_max) nogil
+        vector[pair[int, pair[double, double]]] get_persistence(int homology_coeff_field, double min_persistence, bool homology_backend) nogil
         vector[int] betti_numbers()
         vector[int] persistent_betti_numbers(double from_value, double to_value)
         vector[pair[double,double]] intervals_in_dimension(int dimension)
@@ -59,6 +62,14 @@ cdef class CubicalComplex:
 
         Or
 
+        :param top_dimensional_cells: A multidimensional array of cells
+            filtration values, whose shape gives the dimensions. It is read in
+            place, without any copy, when it is a Fortran contiguous array of
+            float64, e.g. a numpy.asfortranarray(image, dtype=numpy.float64).
+        :type top_dimensional_cells: numpy array of double
+
+        Or
+
         :param perseus_file: A Perseus-style file name.
         :type perseus_file: string
         """
@@ -67,7 +78,11 @@ cdef class CubicalComplex:
     def __cinit__(self, dimensions=None, top_dimensional_cells=None,
                   perseus_file=''):
         if (dimensions is not None) and (top_dimensional_cells is not None) and (perseus_file is ''):
-            self.thisptr = new Bitmap_cubical_complex_base_interface(dimensions, top_dimensional_cells)
+            self._construct_from_cells(dimensions, top_dimensional_cells)
+        elif (dimensions is None) and (top_dimensional_cells is not None) and (perseus_file is ''):
+            # The shape of the array gives the dimensions
+            cells = np_asarray(top_dimensional_cells, dtype='float64')
+            self._construct_from_cells(cells.shape, cells)
         elif (dimensions is None) and (top_dimensional_cells is None) and (perseus_file is not ''):
             if os.path.isfile(perseus_file):
                 self.thisptr = new Bitmap_cubical_complex_base_interface(str.encode(perseus_file))
@@ -77,6 +92,21 @@ cdef class CubicalComplex:
             print("CubicalComplex can be constructed from dimensions and "
               "top_dimensional_cells or from a Perseus-style file name.")
 
+    cdef _construct_from_cells(self, dimensions, top_dimensional_cells):
+        cdef vector[unsigned] cdimensions = dimensions
+        # The first dimension varies the fastest, as in Fortran order. No copy is done when the array is already
+        # contiguous in this order.
+        cdef double[::1] cells = np_asarray(top_dimensional_cells, dtype='float64').ravel(order='F')
+        if cells.shape[0] != np_prod(dimensions, dtype='int64'):
+            raise ValueError("The number of top dimensional cells does not match the dimensions.")
+        cdef const double* cells_ptr = NULL
+        if cells.shape[0] > 0:
+            cells_ptr = &cells[0]
+        cdef Bitmap_cubical_complex_base_interface* ptr
+        with nogil:
+            ptr = new Bitmap_cubical_complex_base_interface(cdimensions, cells_ptr)
+        self.thisptr = ptr
+
     def __dealloc__(self):
         if self.thisptr != NULL:
             del self.thisptr
@@ -107,7 +137,7 @@ cdef class CubicalComplex:
         """
         return self.thisptr.dimension()
 
-    def persistence(self, homology_coeff_field=11, min_persistence=0):
+    def persistence(self, homology_coeff_field=11, min_persistence=0, backend="cohomology"):
         """This function returns the persistence of the complex.
 
         :param homology_coeff_field: The homology coefficient field. Must be a
@@ -118,16 +148,28 @@ cdef class CubicalComplex:
             0.0.
             Sets min_persistence to -1.0 to see all values.
         :type min_persistence: float.
+        :param backend: The reduction used to compute the persistence:
+            "cohomology" for the compressed annotation matrix, or "homology"
+            for the twist reduction of the boundary matrix, which is often
+            faster on cubical complexes. Default is "cohomology".
+        :type backend: string
         :returns: list of pairs(dimension, pair(birth, death)) -- the
             persistence of the complex.
         """
+        if backend not in ("cohomology", "homology"):
+            raise ValueError("backend must be 'cohomology' or 'homology'")
         if self.pcohptr != NULL:
             del self.pcohptr
-        if self.thisptr != NULL:
-            self.pcohptr = new Cubical_complex_persistence_interface(self.thisptr, True)
+            self.pcohptr = NULL
+        cdef int chomology_coeff_field = homology_coeff_field
+        cdef double cmin_persistence = min_persistence
+        cdef bool chomology_backend = backend == "homology"
         cdef vector[pair[int, pair[double, double]]] persistence_result
-        if self.pcohptr != NULL:
-            persistence_result = self.pcohptr.get_persistence(homology_coeff_field, min_persistence)
+        if self.thisptr != NULL:
+            with nogil:
+                self.pcohptr = new Cubical_complex_persistence_interface(self.thisptr, True)
+                persistence_result = self.pcohptr.get_persistence(chomology_coeff_field, cmin_persistence,
+                                                                  chomology_backend)
         return persistence_result
 
     def betti_numbers(self):
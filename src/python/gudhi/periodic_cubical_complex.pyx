@@ -30,8 +30,8 @@ cdef extern from "Cubical_complex_interface.h" namespace "Gudhi":
 
 cdef extern from "Persistent_cohomology_interface.h" namespace "Gudhi":
     cdef cppclass Periodic_cubical_complex_persistence_interface "Gudhi::Persistent_cohomology_interface<Gudhi::Cubical_complex::Cubical_complex_interface<Gudhi::cubical_complex::Bitmap_cubical_complex_periodic_boundary_conditions_base<double>>>":
-        Periodic_cubical_complex_persistence_interface(Periodic_cubical_complex_base_interface * st, bool persistence_dim_max)
-        vector[pair[int, pair[double, double]]] get_persistence(int homology_coeff_field, double min_persistence)
+        Periodic_cubical_complex_persistence_interface(Periodic_cubical_complex_base_interface * st, bool persistence_dim_max) nogil
+        vector[pair[int, pair[double, double]]] get_persistence(int homology_coeff_field, double min_persistence, bool homology_backend) nogil
         vector[int] betti_numbers()
         vector[int] persistent_betti_numbers(double from_value, double to_value)
         vector[pair[double,double]] intervals_in_dimension(int dimension)
@@ -109,7 +109,7 @@ cdef class PeriodicCubicalComplex:
         """
         return self.thisptr.dimension()
 
-    def persistence(self, homology_coeff_field=11, min_persistence=0):
+    def persistence(self, homology_coeff_field=11, min_persistence=0, backend="cohomology"):
         """This function returns the persistence of the complex.
 
         :param homology_coeff_field: The homology coefficient field. Must be a
@@ -120,16 +120,28 @@ cdef class PeriodicCubicalComplex:
             0.0.
             Sets min_persistence to -1.0 to see all values.
         :type min_persistence: float.
+        :param backend: The reduction used to compute the persistence:
+            "cohomology" for the compressed annotation matrix, or "homology"
+            for the twist reduction of the boundary matrix, which is often
+            faster on cubical complexes. Default is "cohomology".
+        :type backend: string
         :returns: list of pairs(dimension, pair(birth, death)) -- the
             persistence of the complex.
         """
+        if backend not in ("cohomology", "homology"):
+            raise ValueError("backend must be 'cohomology' or 'homology'")
         if self.pcohptr != NULL:
             del self.pcohptr
-        if self.thisptr != NULL:
-            self.pcohptr = new Periodic_cubical_complex_persistence_interface(self.thisptr, True)
+            self.pcohptr = NULL
+        cdef int chomology_coeff_field = homology_coeff_field
+        cdef double cmin_persistence = min_persistence
+        cdef bool chomology_backend = backend == "homology"
         cdef vector[pair[int, pair[double, double]]] persistence_result
-        if self.pcohptr != NULL:
-            persistence_result = self.pcohptr.get_persistence(homology_coeff_field, min_persistence)
+        if self.thisptr != NULL:
+            with nogil:
+                self.pcohptr = new Periodic_cubical_complex_persistence_interface(self.thisptr, True)
+                persistence_result = self.pcohptr.get_persistence(chomology_coeff_field, cmin_persistence,
+                                                                  chomology_backend)
         return persistence_result
 
     def betti_numbers(self):
@@ -25,11 +25,12 @@ __license__ = "MIT"
 cdef extern from "Rips_complex_interface.h" namespace "Gudhi":
     cdef cppclass Rips_complex_interface "Gudhi::rips_complex::Rips_complex_interface":
         Rips_complex_interface()
-        void init_points(vector[vector[double]] values, double threshold)
-        void init_matrix(vector[vector[double]] values, double threshold)
-        void init_points_sparse(vector[vector[double]] values, double threshold, double sparse)
-        void init_matrix_sparse(vector[vector[double]] values, double threshold, double sparse)
-        void create_simplex_tree(Simplex_tree_interface_full_featured* simplex_tree, int dim_max)
+        void init_points(vector[vector[double]] values, double threshold) nogil
+        void init_matrix(vector[vector[double]] values, double threshold) nogil
+        void init_points_sparse(vector[vector[double]] values, double threshold, double sparse) nogil
+        void init_matrix_sparse(vector[vector[double]] values, double threshold, double sparse) nogil
+        void create_simplex_tree(Simplex_tree_interface_full_featured* simplex_tree, int dim_max,
+                                 bool collapse_edges) except + nogil
 
 # RipsComplex python interface
 cdef class RipsComplex:
@@ -68,36 +69,55 @@ cdef class RipsComplex:
     # The real cython constructor
     def __cinit__(self, points=None, distance_matrix=None,
                   max_edge_length=float('inf'), sparse=None):
+        cdef vector[vector[double]] values
+        cdef double threshold = max_edge_length
+        cdef double csparse
+        if distance_matrix is not None:
+            values = distance_matrix
+        elif points is not None:
+            values = points
+        # else empty Rips construction
         if sparse is not None:
+          csparse = sparse
           if distance_matrix is not None:
-              self.thisref.init_matrix_sparse(distance_matrix,
-                                              max_edge_length,
-                                              sparse)
+              with nogil:
+                  self.thisref.init_matrix_sparse(values, threshold, csparse)
           else:
-              if points is None:
-                  # Empty Rips construction
-                  points=[]
-              self.thisref.init_points_sparse(points, max_edge_length, sparse)
+              with nogil:
+                  self.thisref.init_points_sparse(values, threshold, csparse)
         else:
           if distance_matrix is not None:
-              self.thisref.init_matrix(distance_matrix, max_edge_length)
+              with nogil:
+                  self.thisref.init_matrix(values, threshold)
           else:
-              if points is None:
-                  # Empty Rips construction
-                  points=[]
-              self.thisref.init_points(points, max_edge_length)
+              with nogil:
+                  self.thisref.init_points(values, threshold)
 
 
-    def create_simplex_tree(self, max_dimension=1):
+    def create_simplex_tree(self, max_dimension=1, collapse_edges=False):
         """
         :param max_dimension: graph expansion for rips until this given maximal
             dimension.
         :type max_dimension: int
+        :param collapse_edges: If true, the dominated edges of the Rips graph
+            are removed before the expansion. The simplex tree is much
+            smaller and has the same persistence diagram (up to intervals of
+            length 0) in dimensions lower than max_dimension, but its
+            simplices and filtration values differ from the Rips complex ones.
+            Its dimension is set to max_dimension, for the persistence in
+            dimension max_dimension - 1 to be computed by default. The Rips
+            graph itself is not modified by the collapse. Not available for
+            sparse Rips complexes. Default is false.
+        :type collapse_edges: bool
         :returns: A simplex tree created from the Delaunay Triangulation.
         :rtype: SimplexTree
+        :raises ValueError: If collapse_edges is true on a sparse Rips complex.
         """
         stree = SimplexTree()
         cdef intptr_t stree_int_ptr=stree.thisptr
-        self.thisref.create_simplex_tree(<Simplex_tree_interface_full_featured*>stree_int_ptr,
-            max_dimension)
+        cdef int cmax_dimension = max_dimension
+        cdef bool ccollapse_edges = collapse_edges
+        with nogil:
+            self.thisref.create_simplex_tree(<Simplex_tree_interface_full_featured*>stree_int_ptr,
+                cmax_dimension, ccollapse_edges)
         return stree
@@ -26,7 +26,7 @@ cdef extern from "Simplex_tree_interface.h" namespace "Gudhi":
         Simplex_tree()
         double simplex_filtration(vector[int] simplex)
         void assign_simplex_filtration(vector[int] simplex, double filtration)
-        void initialize_filtration()
+        void initialize_filtration() nogil
         int num_vertices()
         int num_simplices()
         void set_dimension(int dimension)
@@ -37,20 +37,23 @@ cdef extern from "Simplex_tree_interface.h" namespace "Gudhi":
                                          double filtration)
         vector[pair[vector[int], double]] get_filtration()
         vector[pair[vector[int], double]] get_skeleton(int dimension)
+        void get_flat_filtration(vector[vector[int]]& vertices, vector[vector[double]]& filtrations)
+        void get_flat_skeleton(int dimension, vector[vector[int]]& vertices, vector[vector[double]]& filtrations)
         vector[pair[vector[int], double]] get_star(vector[int] simplex)
         vector[pair[vector[int], double]] get_cofaces(vector[int] simplex,
                                                           int dimension)
-        void expansion(int max_dim)
+        void expansion(int max_dim) nogil
         void remove_maximal_simplex(vector[int] simplex)
         bool prune_above_filtration(double filtration)
         bool make_filtration_non_decreasing()
 
 cdef extern from "Persistent_cohomology_interface.h" namespace "Gudhi":
     cdef cppclass Simplex_tree_persistence_interface "Gudhi::Persistent_cohomology_interface<Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_full_featured>>":
-        Simplex_tree_persistence_interface(Simplex_tree_interface_full_featured * st, bool persistence_dim_max)
-        vector[pair[int, pair[double, double]]] get_persistence(int homology_coeff_field, double min_persistence)
+        Simplex_tree_persistence_interface(Simplex_tree_interface_full_featured * st, bool persistence_dim_max) nogil
+        vector[pair[int, pair[double, double]]] get_persistence(int homology_coeff_field, double min_persistence, bool homology_backend) nogil
         vector[int] betti_numbers()
         vector[int] persistent_betti_numbers(double from_value, double to_value)
         vector[pair[double,double]] intervals_in_dimension(int dimension)
+        vector[vector[double]] flat_intervals_by_dimension()
         void write_output_diagram(string diagram_file_name)
         vector[pair[vector[int], vector[int]]] persistence_pairs()
@@ -1,5 +1,8 @@
 from libc.stdint cimport intptr_t
+from cpython cimport Py_buffer
 from numpy import array as np_array
+from numpy import asarray as np_asarray
+from numpy import empty as np_empty
 cimport simplex_tree
 
 """ This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
@@ -16,6 +19,74 @@ __author__ = "Vincent Rouvreau"
 __copyright__ = "Copyright (C) 2016 Inria"
 __license__ = "MIT"
 
+# Owners of C++ vectors, exposed to numpy through the buffer protocol, so that arrays are views on C++ memory
+cdef class _Int_buffer:
+    cdef vector[int] data
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t strides[1]
+
+    def __getbuffer__(self, Py_buffer *buffer, int flags):
+        self.shape[0] = self.data.size()
+        self.strides[0] = sizeof(int)
+        buffer.buf = <char *>self.data.data()
+        buffer.format = 'i'
+        buffer.internal = NULL
+        buffer.itemsize = sizeof(int)
+        buffer.len = self.data.size() * sizeof(int)
+        buffer.ndim = 1
+        buffer.obj = self
+        buffer.readonly = 0
+        buffer.shape = self.shape
+        buffer.strides = self.strides
+        buffer.suboffsets = NULL
+
+    def __releasebuffer__(self, Py_buffer *buffer):
+        pass
+
+cdef class _Double_buffer:
+    cdef vector[double] data
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t strides[1]
+
+    def __getbuffer__(self, Py_buffer *buffer, int flags):
+        self.shape[0] = self.data.size()
+        self.strides[0] = sizeof(double)
+        buffer.buf = <char *>self.data.data()
+        buffer.format = 'd'
+        buffer.internal = NULL
+        buffer.itemsize = sizeof(double)
+        buffer.len = self.data.size() * sizeof(double)
+        buffer.ndim = 1
+        buffer.obj = self
+        buffer.readonly = 0
+        buffer.shape = self.shape
+        buffer.strides = self.strides
+        buffer.suboffsets = NULL
+
+    def __releasebuffer__(self, Py_buffer *buffer):
+        pass
+
+# Moves data in a numpy array, data is left empty
+cdef _int_array(vector[int]& data):
+    if data.empty():
+        return np_empty(0, dtype='intc')
+    cdef _Int_buffer owner = _Int_buffer()
+    owner.data.swap(data)
+    return np_asarray(owner)
+
+cdef _double_array(vector[double]& data):
+    if data.empty():
+        return np_empty(0, dtype='double')
+    cdef _Double_buffer owner = _Double_buffer()
+    owner.data.swap(data)
+    return np_asarray(owner)
+
+cdef _simplices_arrays(vector[vector[int]]& vertices, vector[vector[double]]& filtrations):
+    arrays = []
+    for dim in range(vertices.size()):
+        arrays.append((_int_array(vertices[dim]).reshape(-1, dim + 1), _double_array(filtrations[dim])))
+    return arrays
+
 # SimplexTree python interface
 cdef class SimplexTree:
     """The simplex tree is an efficient and flexible data structure for
@@ -100,7 +171,9 @@ cdef class SimplexTree:
             :func:`removing<gudhi.SimplexTree.remove_maximal_simplex>`
             simplices.
         """
-        self.get_ptr().initialize_filtration()
+        cdef Simplex_tree_interface_full_featured* ptr = self.get_ptr()
+        with nogil:
+            ptr.initialize_filtration()
 
     def num_vertices(self):
         """This function returns the number of vertices of the simplicial
@@ -235,6 +308,44 @@ cdef class SimplexTree:
             ct.append((v, filtered_simplex.second))
         return ct
 
+    def get_filtration_arrays(self):
+        """This function returns all simplices with their given filtration
+        values, as numpy arrays by dimension. Unlike
+        :func:`get_filtration()<gudhi.SimplexTree.get_filtration>`, no Python
+        object is created per simplex: arrays are views on the memory filled
+        by the C++ code.
+
+        :returns:  For each dimension d, the pair (vertices, filtrations),
+            where vertices is the array of shape (n, d + 1) of the vertices of
+            the n simplices of dimension d, in increasing order, and
+            filtrations the array of their n filtration values. In each
+            dimension, simplices are sorted by increasing filtration values.
+        :rtype:  list of tuples(numpy array of dimension 2, numpy array of
+            dimension 1)
+        """
+        cdef vector[vector[int]] vertices
+        cdef vector[vector[double]] filtrations
+        self.get_ptr().get_flat_filtration(vertices, filtrations)
+        return _simplices_arrays(vertices, filtrations)
+
+    def get_skeleton_arrays(self, dimension):
+        """This function returns the (simplices of the) skeleton of a maximum
+        given dimension, as numpy arrays by dimension, like
+        :func:`get_filtration_arrays()<gudhi.SimplexTree.get_filtration_arrays>`.
+
+        :param dimension: The skeleton dimension value.
+        :type dimension: int.
+        :returns:  For each dimension d up to the skeleton dimension, the pair
+            (vertices, filtrations) of the simplices of dimension d. Empty if
+            dimension is negative.
+        :rtype:  list of tuples(numpy array of dimension 2, numpy array of
+            dimension 1)
+        """
+        cdef vector[vector[int]] vertices
+        cdef vector[vector[double]] filtrations
+        self.get_ptr().get_flat_skeleton(<int>dimension, vertices, filtrations)
+        return _simplices_arrays(vertices, filtrations)
+
     def get_star(self, simplex):
         """This function returns the star of a given N-simplex.
 
@@ -355,7 +466,10 @@ cdef class SimplexTree:
         :param max_dim: The maximal dimension.
         :type max_dim: int.
         """
-        self.get_ptr().expansion(max_dim)
+        cdef Simplex_tree_interface_full_featured* ptr = self.get_ptr()
+        cdef int cmax_dim = max_dim
+        with nogil:
+            ptr.expansion(cmax_dim)
 
     def make_filtration_non_decreasing(self):
         """This function ensures that each simplex has a higher filtration
@@ -378,7 +492,8 @@ cdef class SimplexTree:
         """
         return self.get_ptr().make_filtration_non_decreasing()
 
-    def persistence(self, homology_coeff_field=11, min_persistence=0, persistence_dim_max = False):
+    def persistence(self, homology_coeff_field=11, min_persistence=0, persistence_dim_max = False,
+                    backend="cohomology"):
         """This function returns the persistence of the simplicial complex.
 
         :param homology_coeff_field: The homology coefficient field. Must be a
@@ -393,15 +508,29 @@ cdef class SimplexTree:
             maximal dimension in the complex is computed. If false, it is
             ignored. Default is false.
         :type persistence_dim_max: bool
+        :param backend: The reduction used to compute the persistence:
+            "cohomology" for the compressed annotation matrix, or "homology"
+            for the twist reduction of the boundary matrix, which is often
+            faster on cubical complexes. Default is "cohomology".
+        :type backend: string
         :returns: The persistence of the simplicial complex.
         :rtype:  list of pairs(dimension, pair(birth, death))
         """
+        if backend not in ("cohomology", "homology"):
+            raise ValueError("backend must be 'cohomology' or 'homology'")
         if self.pcohptr != NULL:
             del self.pcohptr
-        self.pcohptr = new Simplex_tree_persistence_interface(self.get_ptr(), persistence_dim_max)
+            self.pcohptr = NULL
+        cdef Simplex_tree_interface_full_featured* ptr = self.get_ptr()
+        cdef bool cpersistence_dim_max = persistence_dim_max
+        cdef int chomology_coeff_field = homology_coeff_field
+        cdef double cmin_persistence = min_persistence
+        cdef bool chomology_backend = backend == "homology"
         cdef vector[pair[int, pair[double, double]]] persistence_result
-        if self.pcohptr != NULL:
-            persistence_result = self.pcohptr.get_persistence(homology_coeff_field, min_persistence)
+        with nogil:
+            self.pcohptr = new Simplex_tree_persistence_interface(ptr, cpersistence_dim_max)
+            persistence_result = self.pcohptr.get_persistence(chomology_coeff_field, cmin_persistence,
+                                                              chomology_backend)
         return persistence_result
 
     def betti_numbers(self):
@@ -469,6 +598,30 @@ cdef class SimplexTree:
                   " to be launched first.")
         return np_array(intervals_result)
 
+    def persistence_intervals_arrays(self):
+        """This function returns the persistence intervals of the simplicial
+        complex in all dimensions, as numpy arrays, without creating a Python
+        object per interval.
+
+        :returns: For each dimension d, the array of shape (n, 2) of the birth
+            and death values of the n persistence intervals of dimension d.
+        :rtype:  list of numpy array of dimension 2
+
+        :note: persistence_intervals_arrays function requires
+            :func:`persistence()<gudhi.SimplexTree.persistence>`
+            function to be launched first.
+        """
+        cdef vector[vector[double]] intervals_result
+        if self.pcohptr != NULL:
+            intervals_result = self.pcohptr.flat_intervals_by_dimension()
+        else:
+            print("persistence_intervals_arrays function requires persistence function"
+                  " to be launched first.")
+        intervals = []
+        for dim in range(intervals_result.size()):
+            intervals.append(_double_array(intervals_result[dim]).reshape(-1, 2))
+        return intervals
+
     def persistence_pairs(self):
         """This function returns a list of persistence birth and death simplices pairs.
 
@@ -12,6 +12,7 @@
 #define INCLUDE_BOTTLENECK_DISTANCE_INTERFACE_H_
 
 #include <gudhi/Bottleneck.h>
+#include <gudhi/Wasserstein.h>
 
 #include <iostream>
 #include <vector>
@@ -33,6 +34,21 @@ namespace persistence_diagram {
     return bottleneck_distance(diag1, diag2);
   }
 
+  std::vector<std::vector<double>> bottleneck_matrix(const std::vector<std::vector<std::pair<double, double>>>& diags,
+                                                     double e) {
+    return bottleneck_distance_matrix(diags, e);
+  }
+
+  std::vector<std::vector<double>> bottleneck_matrix(const std::vector<std::vector<std::pair<double, double>>>& diags) {
+    return bottleneck_distance_matrix(diags);
+  }
+
+  double wasserstein(const std::vector<std::pair<double, double>>& diag1,
+                     const std::vector<std::pair<double, double>>& diag2,
+                     double order, double delta) {
+    return wasserstein_distance(diag1, diag2, order, delta);
+  }
+
 }  // namespace persistence_diagram
 
 }  // namespace Gudhi
@@ -31,6 +31,11 @@ class Cubical_complex_interface : public Bitmap_cubical_complex<CubicalComplexOp
   : Bitmap_cubical_complex<CubicalComplexOptions>(dimensions, top_dimensional_cells) {
   }
 
+  Cubical_complex_interface(const std::vector<unsigned>& dimensions,
+                            const double* top_dimensional_cells)
+  : Bitmap_cubical_complex<CubicalComplexOptions>(dimensions, top_dimensional_cells) {
+  }
+
   Cubical_complex_interface(const std::vector<unsigned>& dimensions,
                             const std::vector<double>& top_dimensional_cells,
                             const std::vector<bool>& periodic_dimensions)
@@ -12,6 +12,7 @@
 #define INCLUDE_PERSISTENT_COHOMOLOGY_INTERFACE_H_
 
 #include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistent_homology.h>
 
 #include <vector>
 #include <utility>  // for std::pair
@@ -44,19 +45,33 @@ persistent_cohomology::Persistent_cohomology<FilteredComplex, persistent_cohomol
  public:
   Persistent_cohomology_interface(FilteredComplex* stptr)
       : persistent_cohomology::Persistent_cohomology<FilteredComplex, persistent_cohomology::Field_Zp>(*stptr),
-      stptr_(stptr) { }
+      stptr_(stptr),
+      persistence_dim_max_(false) { }
 
   Persistent_cohomology_interface(FilteredComplex* stptr, bool persistence_dim_max)
       : persistent_cohomology::Persistent_cohomology<FilteredComplex,
           persistent_cohomology::Field_Zp>(*stptr, persistence_dim_max),
-        stptr_(stptr) { }
+        stptr_(stptr),
+        persistence_dim_max_(persistence_dim_max) { }
 
+  // When homology_backend is true, the persistence pairs are computed by the twist reduction of the boundary matrix
+  // (Persistent_homology) instead of the compressed annotation matrix. Both give the same persistence diagram.
   std::vector<std::pair<int, std::pair<double, double>>> get_persistence(int homology_coeff_field,
-                                                                         double min_persistence) {
-    persistent_cohomology::Persistent_cohomology<FilteredComplex,
-      persistent_cohomology::Field_Zp>::init_coefficients(homology_coeff_field);
-    persistent_cohomology::Persistent_cohomology<FilteredComplex,
-      persistent_cohomology::Field_Zp>::compute_persistent_cohomology(min_persistence);
+                                                                         double min_persistence,
+                                                                         bool homology_backend = false) {
+    if (homology_backend) {
+      persistent_cohomology::Persistent_homology<FilteredComplex,
+        persistent_cohomology::Field_Zp> phom(*stptr_, persistence_dim_max_);
+      phom.init_coefficients(homology_coeff_field);
+      phom.compute_persistent_homology(min_persistence);
+      // Copied in the base class, for betti numbers and persistence intervals queries
+      this->persistent_pairs_ = phom.get_persistent_pairs();
+    } else {
+      persistent_cohomology::Persistent_cohomology<FilteredComplex,
+        persistent_cohomology::Field_Zp>::init_coefficients(homology_coeff_field);
+      persistent_cohomology::Persistent_cohomology<FilteredComplex,
+        persistent_cohomology::Field_Zp>::compute_persistent_cohomology(min_persistence);
+    }
 
     // Custom sort and output persistence
     cmp_intervals_by_dim_then_length cmp(stptr_);
@@ -73,6 +88,20 @@ persistent_cohomology::Persistent_cohomology<FilteredComplex, persistent_cohomol
     return persistence;
   }
 
+  // Persistence intervals by dimension, as consecutive (birth, death) values, in one pass over the persistent pairs.
+  // Python exposes them to numpy as (n, 2) arrays without any copy.
+  std::vector<std::vector<double>> flat_intervals_by_dimension() {
+    std::vector<std::vector<double>> intervals((std::max)(stptr_->dimension(), 0) + 1);
+    auto const& persistent_pairs = persistent_cohomology::Persistent_cohomology<FilteredComplex,
+      persistent_cohomology::Field_Zp>::get_persistent_pairs();
+    for (auto const& pair : persistent_pairs) {
+      std::vector<double>& dim_intervals = intervals[stptr_->dimension(get<0>(pair))];
+      dim_intervals.push_back(stptr_->filtration(get<0>(pair)));
+      dim_intervals.push_back(stptr_->filtration(get<1>(pair)));
+    }
+    return intervals;
+  }
+
   std::vector<std::pair<std::vector<int>, std::vector<int>>> persistence_pairs() {
     auto pairs = persistent_cohomology::Persistent_cohomology<FilteredComplex,
       persistent_cohomology::Field_Zp>::get_persistent_pairs();
@@ -102,6 +131,7 @@ persistent_cohomology::Persistent_cohomology<FilteredComplex, persistent_cohomol
  private:
   // A copy
   FilteredComplex* stptr_;
+  bool persistence_dim_max_;
 };
 
 }  // namespace Gudhi
@@ -24,6 +24,7 @@
 #include <vector>
 #include <utility>  // std::pair
 #include <string>
+#include <stdexcept>  // for std::invalid_argument
 
 namespace Gudhi {
 
@@ -48,11 +49,25 @@ class Rips_complex_interface {
     sparse_rips_complex_.emplace(matrix, epsilon, -std::numeric_limits<double>::infinity(), threshold);
   }
 
-  void create_simplex_tree(Simplex_tree_interface<>* simplex_tree, int dim_max) {
-    if (rips_complex_)
-      rips_complex_->create_complex(*simplex_tree, dim_max);
-    else
+  void create_simplex_tree(Simplex_tree_interface<>* simplex_tree, int dim_max, bool collapse_edges) {
+    if (rips_complex_) {
+      if (collapse_edges) {
+        // Collapse a copy, the graph is kept for the next calls
+        Rips_complex<Simplex_tree_interface<>::Filtration_value> collapsed_rips_complex(*rips_complex_);
+        collapsed_rips_complex.collapse_edges();
+        collapsed_rips_complex.create_complex(*simplex_tree, dim_max);
+        // The collapse may lower the dimension of the complex, but its persistence is still the one of the Rips
+        // complex in all the dimensions lower than dim_max
+        if (simplex_tree->dimension() < dim_max)
+          simplex_tree->set_dimension(dim_max);
+      } else {
+        rips_complex_->create_complex(*simplex_tree, dim_max);
+      }
+    } else {
+      if (collapse_edges)
+        throw std::invalid_argument("Edge collapse is not available for sparse Rips complexes");
       sparse_rips_complex_->create_complex(*simplex_tree, dim_max);
+    }
     simplex_tree->initialize_filtration();
   }
 
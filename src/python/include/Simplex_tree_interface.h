@@ -21,6 +21,7 @@
 #include <iostream>
 #include <vector>
 #include <utility>  // std::pair
+#include <algorithm>  // for std::min
 
 namespace Gudhi {
 
@@ -34,6 +35,8 @@ class Simplex_tree_interface : public Simplex_tree<SimplexTreeOptions> {
   using Insertion_result = typename std::pair<Simplex_handle, bool>;
   using Simplex = std::vector<Vertex_handle>;
   using Filtered_simplices = std::vector<std::pair<Simplex, Filtration_value>>;
+  using Flat_vertices = std::vector<std::vector<Vertex_handle>>;
+  using Flat_filtrations = std::vector<std::vector<Filtration_value>>;
 
  public:
   bool find_simplex(const Simplex& vh) {
@@ -107,6 +110,25 @@ class Simplex_tree_interface : public Simplex_tree<SimplexTreeOptions> {
     return skeletons;
   }
 
+  // Simplices by dimension, by increasing filtration value: vertices[d] gathers the d + 1 vertices of each simplex of
+  // dimension d, in increasing order, and filtrations[d] their filtration values. Python exposes these buffers to
+  // numpy without any copy, unlike the vectors of pairs.
+  void get_flat_filtration(Flat_vertices& vertices, Flat_filtrations& filtrations) {
+    Base::initialize_filtration();
+    flat_simplices(Base::filtration_simplex_range(), Base::dimension(), vertices, filtrations);
+  }
+
+  void get_flat_skeleton(int dimension, Flat_vertices& vertices, Flat_filtrations& filtrations) {
+    // A skeleton of negative dimension is empty, but skeleton_simplex_range would still go through the vertices
+    if (dimension < 0) {
+      vertices.clear();
+      filtrations.clear();
+      return;
+    }
+    flat_simplices(Base::skeleton_simplex_range(dimension), (std::min)(dimension, Base::dimension()), vertices,
+                   filtrations);
+  }
+
   Filtered_simplices get_star(const Simplex& simplex) {
     Filtered_simplices star;
     for (auto f_simplex : Base::star_simplex_range(Base::find(simplex))) {
@@ -135,6 +157,25 @@ class Simplex_tree_interface : public Simplex_tree<SimplexTreeOptions> {
     Base::initialize_filtration();
     pcoh = new Gudhi::Persistent_cohomology_interface<Base>(*this);
   }
+
+ private:
+  template<class SimplexRange>
+  void flat_simplices(const SimplexRange& simplices, int max_dimension, Flat_vertices& vertices,
+                      Flat_filtrations& filtrations) {
+    vertices.assign(max_dimension + 1, Simplex());
+    filtrations.assign(max_dimension + 1, std::vector<Filtration_value>());
+    for (auto f_simplex : simplices) {
+      int dim = Base::dimension(f_simplex);
+      Simplex& dim_vertices = vertices[dim];
+      // simplex_vertex_range is in decreasing order
+      std::size_t position = dim_vertices.size() + dim;
+      dim_vertices.resize(dim_vertices.size() + dim + 1);
+      for (auto vertex : Base::simplex_vertex_range(f_simplex)) {
+        dim_vertices[position--] = vertex;
+      }
+      filtrations[dim].push_back(Base::filtration(f_simplex));
+    }
+  }
 };
 
 }  // namespace Gudhi
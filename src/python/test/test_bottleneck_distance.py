@@ -21,3 +21,34 @@ def test_basic_bottleneck():
 
     assert gudhi.bottleneck_distance(diag1, diag2, 0.1) == 0.8081763781405569
     assert gudhi.bottleneck_distance(diag1, diag2) == 0.75
+
+
+def test_bottleneck_distance_matrix():
+    diag1 = [[2.7, 3.7], [9.6, 14.0], [34.2, 34.974], [3.0, float("Inf")]]
+    diag2 = [[2.8, 4.45], [9.5, 14.1], [3.2, float("Inf")]]
+    diag3 = [[1.0, 2.0]]
+    diagrams = [diag1, diag2, diag3]
+
+    for e in [None, 0.1, 0.]:
+        matrix = gudhi.bottleneck_distance_matrix(diagrams, e)
+        assert matrix.shape == (3, 3)
+        for i in range(3):
+            assert matrix[i][i] == 0.
+            for j in range(i + 1, 3):
+                assert matrix[i][j] == matrix[j][i]
+                if e is None:
+                    assert matrix[i][j] == gudhi.bottleneck_distance(diagrams[i], diagrams[j])
+                else:
+                    assert matrix[i][j] == gudhi.bottleneck_distance(diagrams[i], diagrams[j], e)
+    assert matrix[0][2] == float("Inf")
+
+
+def test_wasserstein_distance():
+    diag1 = [[2.7, 3.7], [9.6, 14.0], [34.2, 34.974], [3.0, float("Inf")]]
+    diag2 = [[2.8, 4.45], [9.5, 14.1], [3.2, float("Inf")]]
+
+    assert gudhi.wasserstein_distance(diag1, diag1) == 0.
+    # 0.2 for the infinite points, 0.75 + 0.1 for the matched points and 0.387 to the diagonal
+    assert abs(gudhi.wasserstein_distance(diag1, diag2, delta=0.001) - 1.437) <= 1.437 * 0.001
+    assert abs(gudhi.wasserstein_distance(diag2, diag1, 2.) - (0.04 + 0.5625 + 0.01 + 0.387 ** 2) ** 0.5) <= 0.01
+    assert gudhi.wasserstein_distance(diag1, [[1.0, 2.0]]) == float("Inf")
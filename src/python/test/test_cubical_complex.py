@@ -96,3 +96,35 @@ def test_dimension_file_constructor():
     assert cub.__is_persistence_defined() == True
     assert cub.betti_numbers() == [1, 0, 0]
     assert cub.persistent_betti_numbers(0, 1000) == [1, 0, 0]
+
+
+def test_homology_backend():
+    cub = CubicalComplex(
+        dimensions=[3, 3],
+        top_dimensional_cells=[float("inf"), 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0],
+    )
+    assert cub.persistence(backend="homology") == [(1, (0.0, 1.0)), (0, (0.0, float("inf")))]
+    assert cub.betti_numbers() == [1, 0, 0]
+    assert cub.persistent_betti_numbers(0, 0.5) == [1, 1, 0]
+    try:
+        cub.persistence(backend="unknown")
+        assert False
+    except ValueError:
+        pass
+
+
+def test_numpy_array_constructor():
+    import numpy as np
+
+    cells = np.array([[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 2.0, 0.0], [3.0, 0.0, 4.0]])
+    from_list = CubicalComplex(dimensions=[4, 3], top_dimensional_cells=list(cells.ravel(order="F")))
+    # The shape gives the dimensions, with or without a copy of the array
+    for array in [cells, np.asfortranarray(cells), cells.astype(np.float32)]:
+        cub = CubicalComplex(top_dimensional_cells=array)
+        assert cub.num_simplices() == from_list.num_simplices()
+        assert cub.persistence() == from_list.persistence()
+    try:
+        CubicalComplex(dimensions=[3, 3], top_dimensional_cells=[0.0, 1.0])
+        assert False
+    except ValueError:
+        pass
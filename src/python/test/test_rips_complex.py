@@ -1,5 +1,11 @@
 from gudhi import RipsComplex
 from math import sqrt
+from concurrent.futures import ThreadPoolExecutor
+import os
+import random
+import sys
+import threading
+import time
 
 """ This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
     See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
@@ -131,3 +137,91 @@ def test_filtered_rips_from_distance_matrix():
 
     assert simplex_tree.num_simplices() == 8
     assert simplex_tree.num_vertices() == 4
+
+
+def test_rips_edge_collapse():
+    point_list = [[0, 0], [1, 0], [0, 1], [1, 1], [0.5, 1.5], [2, 0.5]]
+    rips_complex = RipsComplex(points=point_list, max_edge_length=2.0)
+    simplex_tree = rips_complex.create_simplex_tree(max_dimension=2)
+    collapsed_rips = RipsComplex(points=point_list, max_edge_length=2.0)
+    collapsed_tree = collapsed_rips.create_simplex_tree(max_dimension=2, collapse_edges=True)
+
+    assert collapsed_tree.num_simplices() < simplex_tree.num_simplices()
+    # Persistence is preserved in dimensions 0 and 1, also with the default persistence_dim_max=False
+    assert collapsed_tree.dimension() == 2
+    def diagram(stree):
+        return sorted([p for p in stree.persistence() if p[1][1] > p[1][0]])
+    assert diagram(collapsed_tree) == diagram(simplex_tree)
+
+    # The collapse does not modify the Rips graph for the next calls
+    assert collapsed_rips.create_simplex_tree(max_dimension=2).num_simplices() == simplex_tree.num_simplices()
+    assert collapsed_rips.create_simplex_tree(max_dimension=2, collapse_edges=True).num_simplices() == \
+        collapsed_tree.num_simplices()
+
+    sparse_rips = RipsComplex(points=point_list, max_edge_length=2.0, sparse=0.5)
+    try:
+        sparse_rips.create_simplex_tree(max_dimension=2, collapse_edges=True)
+        assert False
+    except ValueError:
+        pass
+
+
+def rips_persistence(seed):
+    rng = random.Random(seed)
+    points = [[rng.random() for _ in range(3)] for _ in range(250)]
+    simplex_tree = RipsComplex(points=points, max_edge_length=0.4).create_simplex_tree(max_dimension=3)
+    return simplex_tree.persistence()
+
+
+def test_rips_persistence_in_threads():
+    seeds = list(range(8))
+    start = time.time()
+    expected = [rips_persistence(seed) for seed in seeds]
+    sequential_time = time.time() - start
+
+    num_threads = min(4, os.cpu_count() or 1)
+    start = time.time()
+    with ThreadPoolExecutor(max_workers=num_threads) as executor:
+        results = list(executor.map(rips_persistence, seeds))
+    threaded_time = time.time() - start
+    # Timings depend on the machine load, they are only reported
+    print("Rips persistence speedup with", num_threads, "threads:", sequential_time / threaded_time)
+    assert results == expected
+
+
+def test_rips_persistence_releases_the_gil():
+    # A helper thread counts while this one computes. With a long switch interval, this thread keeps the GIL until it
+    # blocks, the helper thread can thus only count during the computation if the computation releases the GIL.
+    # The computation is repeated in case the helper thread is not scheduled in time on a loaded machine.
+    rng = random.Random(42)
+    points = [[rng.random() for _ in range(3)] for _ in range(250)]
+    rips_complex = RipsComplex(points=points, max_edge_length=0.4)
+    counter = [0]
+    started = threading.Event()
+    done = threading.Event()
+
+    def count():
+        started.set()
+        while not done.is_set():
+            counter[0] += 1
+            # Gives the GIL back as soon as the computation is over
+            time.sleep(0)
+
+    switch_interval = sys.getswitchinterval()
+    sys.setswitchinterval(100.)
+    thread = threading.Thread(target=count)
+    thread.start()
+    started.wait()
+    counted = False
+    try:
+        for _ in range(10):
+            before = counter[0]
+            rips_complex.create_simplex_tree(max_dimension=3).persistence()
+            if counter[0] > before:
+                counted = True
+                break
+    finally:
+        done.set()
+        thread.join()
+        sys.setswitchinterval(switch_interval)
+    assert counted
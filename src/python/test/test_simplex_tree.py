@@ -248,3 +248,35 @@ def test_make_filtration_non_decreasing():
     assert st.filtration([3, 4, 5]) == 2.0
     assert st.filtration([3, 4]) == 2.0
     assert st.filtration([4, 5]) == 2.0
+
+
+def test_filtration_and_persistence_arrays():
+    st = SimplexTree()
+    st.insert([0, 1, 2], filtration=3.0)
+    st.insert([0, 1], filtration=1.0)
+    st.insert([2, 3], filtration=2.0)
+    st.insert([4], filtration=0.5)
+
+    arrays = st.get_filtration_arrays()
+    assert len(arrays) == st.dimension() + 1
+    # Same simplices, dimension by dimension, in the order of get_filtration
+    for dim in range(len(arrays)):
+        vertices, filtrations = arrays[dim]
+        assert vertices.shape == (len(filtrations), dim + 1)
+        expected = [(simplex, filtration) for (simplex, filtration) in st.get_filtration() if len(simplex) == dim + 1]
+        assert [list(v) for v in vertices] == [simplex for (simplex, filtration) in expected]
+        assert list(filtrations) == [filtration for (simplex, filtration) in expected]
+
+    skeleton = st.get_skeleton_arrays(1)
+    assert len(skeleton) == 2
+    assert sorted(tuple(v) for v in skeleton[1][0]) == [(0, 1), (0, 2), (1, 2), (2, 3)]
+    # Skeletons of negative dimension are empty
+    assert st.get_skeleton_arrays(-1) == []
+    assert st.get_skeleton_arrays(-5) == []
+
+    st.persistence(persistence_dim_max=True)
+    intervals = st.persistence_intervals_arrays()
+    assert len(intervals) == st.dimension() + 1
+    for dim in range(len(intervals)):
+        assert intervals[dim].shape[1] == 2
+        assert sorted(map(tuple, intervals[dim])) == sorted(map(tuple, st.persistence_intervals_in_dimension(dim)))